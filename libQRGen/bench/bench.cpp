@@ -0,0 +1,68 @@
+// Copyright 2024 Benjamin Lutz.
+// 
+// This file is part of QRGen. QRGen is free software: you can redistribute it
+// and/or modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+
+#include "bench.h"
+#include <chrono>
+#include <cstdio>
+#include <string_view>
+#include <utility>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+using namespace std;
+
+
+static vector<pair<const char *, void (*)()>> &benchmarks() {
+    static vector<pair<const char *, void (*)()>> benchmarks;
+    return benchmarks;
+}
+
+
+namespace bench {
+
+uint64_t ticks() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return chrono::duration_cast<chrono::nanoseconds>(
+        chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+
+const char *tickUnit() {
+#if defined(__x86_64__) || defined(__i386__)
+    return "cycles";
+#else
+    return "ns";
+#endif
+}
+
+
+Registration::Registration(const char *name, void (*function)()) {
+    benchmarks().emplace_back(name, function);
+}
+
+} // namespace bench
+
+
+int main(int argc, char *argv[]) {
+    for (const auto &[name, function] : benchmarks()) {
+        bool selected = argc < 2;
+        for (int i = 1; i < argc; ++i) {
+            selected |= string_view(name).find(argv[i]) != string_view::npos;
+        }
+        if (!selected) { continue; }
+        
+        printf("### %s\n", name);
+        function();
+        printf("\n");
+    }
+    return 0;
+}
@@ -0,0 +1,71 @@
+// Copyright 2024 Benjamin Lutz.
+// 
+// This file is part of QRGen. QRGen is free software: you can redistribute it
+// and/or modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+
+/**
+ * A minimal benchmark harness. Benchmarks are defined with BENCHMARK(name)
+ * and run by libQRGenBench, which takes an optional list of name filters as
+ * arguments.
+ */
+namespace bench {
+
+/**
+ * Returns the CPU's time stamp counter where available, otherwise a
+ * nanosecond clock. tickUnit() names the unit.
+ */
+uint64_t ticks();
+const char *tickUnit();
+
+/** Keeps the compiler from optimizing away the computation of \a value. */
+template <typename T>
+inline void doNotOptimize(const T &value) {
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T *sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * Calls \a f \a iterations times in a row, repeats that \a repetitions times,
+ * and returns the lowest number of ticks per call.
+ */
+template <typename F>
+double measure(F &&f, size_t iterations = 100, size_t repetitions = 7) {
+    f(); // warm up
+    double best = std::numeric_limits<double>::max();
+    for (size_t r = 0; r < repetitions; ++r) {
+        const uint64_t start = ticks();
+        for (size_t i = 0; i < iterations; ++i) { f(); }
+        const uint64_t end = ticks();
+        best = std::min(best, double(end - start) / iterations);
+    }
+    return best;
+}
+
+struct Registration {
+    Registration(const char *name, void (*function)());
+};
+
+} // namespace bench
+
+
+#define BENCHMARK(name) \
+    static void bench_##name(); \
+    static const bench::Registration registration_##name{#name, &bench_##name}; \
+    static void bench_##name()
+
+#endif // BENCH_H
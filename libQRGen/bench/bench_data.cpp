@@ -0,0 +1,43 @@
+// Copyright 2024 Benjamin Lutz.
+// 
+// This file is part of QRGen. QRGen is free software: you can redistribute it
+// and/or modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+
+#include <chrono>
+#include <cstdio>
+#include "bench.h"
+#define private public
+#include "../src/data.h"
+
+using namespace std;
+
+
+BENCHMARK(Data_append) {
+    // Appending the 23648 data bits of version 40-L: as 10 bit values, and as
+    // one Data object at a byte boundary and at a bit offset.
+    static constexpr size_t BitCount = 23648;
+    
+    Data other;
+    for (size_t i = 0; i < BitCount / 8; ++i) { other.append(8, i * 167 + 13); }
+    
+    printf("ticks are %s\n", bench::tickUnit());
+    printf("%-14s %14s\n", "append", "ticks");
+    const double values = bench::measure([&]() {
+        Data data;
+        for (uint32_t i = 0; i < BitCount / 10; ++i) { data.append(10, i); }
+        bench::doNotOptimize(data);
+    }, 10, 5);
+    printf("%-14s %14.0f\n", "10 bit values", values);
+    
+    for (size_t offset : { 0, 4 }) {
+        const double ticks = bench::measure([&]() {
+            Data data;
+            data.append(offset, 0);
+            data.append(other);
+            bench::doNotOptimize(data);
+        }, 10, 5);
+        printf("%-14s %14.0f\n", offset == 0 ? "Data, aligned" : "Data, offset 4", ticks);
+    }
+}
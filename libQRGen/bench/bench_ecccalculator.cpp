@@ -0,0 +1,112 @@
+// Copyright 2024 Benjamin Lutz.
+// 
+// This file is part of QRGen. QRGen is free software: you can redistribute it
+// and/or modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+
+#include <cstdio>
+#include <utility>
+#include <vector>
+#include "bench.h"
+#include "../src/ecccalculator.h"
+
+using namespace std;
+
+
+namespace {
+
+struct BlockLayout {
+    const char *symbol;
+    size_t blockCount;
+    size_t dataCount;
+    size_t eccCount;
+};
+
+// Typical block layouts, from QR::ecBlocks
+const BlockLayout layouts[] = {
+    { "1-M", 1, 16, 10 },
+    { "10-M", 4, 43, 26 },
+    { "40-L", 19, 118, 30 },
+    { "40-H", 81, 15, 30 },
+};
+
+const pair<const char *, ECCCalculator::Method> methods[] = {
+    { "Reference", ECCCalculator::Method::Reference },
+    { "Table", ECCCalculator::Method::Table },
+    { "SSSE3", ECCCalculator::Method::SSSE3 },
+    { "GFNI", ECCCalculator::Method::GFNI },
+};
+
+} // namespace
+
+
+BENCHMARK(ECCCalculator_feed) {
+    printf("ticks are %s\n", bench::tickUnit());
+    printf("%-8s %6s %6s %6s  %-10s %12s %12s\n", "symbol", "blocks", "data", "ecc",
+           "method", "ticks/byte", "bytes/tick");
+    
+    for (const BlockLayout &layout : layouts) {
+        vector<uint8_t> data(layout.blockCount * layout.dataCount);
+        for (size_t i = 0; i < data.size(); ++i) { data[i] = i * 167 + 13; }
+        
+        for (const auto &[methodName, method] : methods) {
+            ECCCalculator eccc{layout.eccCount, method};
+            if (eccc.method() != method) { continue; } // not supported by the CPU
+            const double ticks = bench::measure([&]() {
+                for (size_t block = 0; block < layout.blockCount; ++block) {
+                    const uint8_t *begin = &data[block * layout.dataCount];
+                    eccc.reset();
+                    eccc.feed(begin, begin + layout.dataCount);
+                    bench::doNotOptimize(eccc);
+                }
+            });
+            const double perByte = ticks / data.size();
+            printf("%-8s %6zu %6zu %6zu  %-10s %12.2f %12.4f\n", layout.symbol, layout.blockCount,
+                   layout.dataCount, layout.eccCount, methodName, perByte, 1 / perByte);
+        }
+    }
+}
+
+
+BENCHMARK(ECCCalculator_feedBlocks) {
+    // The blocks of 1000 symbols of the same layout, fed one block at a time
+    // and in batches, as in high-volume runs of same-version symbols.
+    static constexpr size_t SymbolCount = 1000;
+    
+    printf("ticks per byte are %s, %zu symbols\n", bench::tickUnit(), SymbolCount);
+    printf("%-8s %6s %6s %6s  %-10s %12s %12s\n", "symbol", "blocks", "data", "ecc",
+           "method", "one by one", "batched");
+    
+    for (const BlockLayout &layout : layouts) {
+        const size_t blockCount = layout.blockCount * SymbolCount;
+        vector<uint8_t> data(blockCount * layout.dataCount);
+        for (size_t i = 0; i < data.size(); ++i) { data[i] = i * 167 + 13; }
+        vector<uint8_t> ecc(blockCount * layout.eccCount);
+        vector<const uint8_t*> blocks;
+        vector<uint8_t*> remainders;
+        for (size_t block = 0; block < blockCount; ++block) {
+            blocks.push_back(&data[block * layout.dataCount]);
+            remainders.push_back(&ecc[block * layout.eccCount]);
+        }
+        
+        for (const auto &[methodName, method] : methods) {
+            if (ECCCalculator{layout.eccCount, method}.method() != method) { continue; }
+            const double single = bench::measure([&]() {
+                for (size_t block = 0; block < blockCount; ++block) {
+                    ECCCalculator::feedBlocks(&blocks[block], &remainders[block], 1,
+                                              layout.dataCount, layout.eccCount, method);
+                }
+                bench::doNotOptimize(ecc);
+            }, 3, 3);
+            const double batched = bench::measure([&]() {
+                ECCCalculator::feedBlocks(blocks.data(), remainders.data(), blockCount,
+                                          layout.dataCount, layout.eccCount, method);
+                bench::doNotOptimize(ecc);
+            }, 3, 3);
+            printf("%-8s %6zu %6zu %6zu  %-10s %12.2f %12.2f\n", layout.symbol, layout.blockCount,
+                   layout.dataCount, layout.eccCount, methodName,
+                   single / data.size(), batched / data.size());
+        }
+    }
+}
@@ -0,0 +1,125 @@
+// Copyright 2024 Benjamin Lutz.
+// 
+// This file is part of QRGen. QRGen is free software: you can redistribute it
+// and/or modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "bench.h"
+#define private public
+#include "../src/qr.h"
+
+using namespace std;
+
+
+BENCHMARK(QR_encodeSegments) {
+    // Segmentation and encoding of 2000 byte payloads of each mode, and of
+    // alphanumeric text with numeric runs, and of Japanese text.
+    struct Payload {
+        const char *mode;
+        string text;
+    };
+    Payload payloads[] = { { "numeric", {} }, { "alphanumeric", {} }, { "eightbit", {} }, { "utf8", {} }, { "mixed", {} }, { "kanji", {} } };
+    for (size_t i = 0; i < 2000; ++i) {
+        payloads[0].text.push_back('0' + i % 10);
+        payloads[1].text.push_back("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:"[i % 45]);
+        payloads[2].text.push_back('a' + i % 26);
+    }
+    while (payloads[3].text.size() < 2000) { payloads[3].text += "Produkt 商品 "; }
+    while (payloads[4].text.size() < 2000) { payloads[4].text += "HTTPS://EX.COM/P/000123456789/"; }
+    while (payloads[5].text.size() < 2000) { payloads[5].text += "商品コード番号"; }
+    
+    printf("ticks are %s\n", bench::tickUnit());
+    printf("%-14s %14s %10s %8s\n", "mode", "encodeSegments", "segments", "version");
+    for (const Payload &payload : payloads) {
+        const double ticks = bench::measure([&]() {
+            bench::doNotOptimize(QR::encodeSegments(QR::segment(payload.text, QRGen_EC_L), QRGen_EC_L));
+        }, 10, 5);
+        const QR::Segmentation segmentation = QR::segment(payload.text, QRGen_EC_L);
+        printf("%-14s %14.0f %10zu %8u\n", payload.mode, ticks, segmentation.segmentCount,
+               unsigned(segmentation.version));
+    }
+}
+
+
+BENCHMARK(QR_encodeModes) {
+    // Packing serial numbers and tracking IDs of increasing length into bits,
+    // without segmentation.
+    string digits, alphanumeric;
+    for (size_t i = 0; i < 4000; ++i) {
+        digits.push_back('0' + (i * 7 + i / 10) % 10);
+        alphanumeric.push_back("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:"[(i * 17) % 45]);
+    }
+    
+    printf("ticks are %s\n", bench::tickUnit());
+    printf("%10s %14s %14s\n", "characters", "numeric", "alphanumeric");
+    for (size_t length : { 20, 100, 1000, 4000 }) {
+        const double numeric = bench::measure([&]() {
+            Data bits;
+            bench::doNotOptimize(QR::encodeNumeric(string_view(digits).substr(0, length), bits));
+            bench::doNotOptimize(bits);
+        }, 10, 5);
+        const double ticks = bench::measure([&]() {
+            Data bits;
+            bench::doNotOptimize(QR::encodeAlphanumeric(string_view(alphanumeric).substr(0, length), bits));
+            bench::doNotOptimize(bits);
+        }, 10, 5);
+        printf("%10zu %14.0f %14.0f\n", length, numeric, ticks);
+    }
+}
+
+
+BENCHMARK(QR_encodeBytes) {
+    // Binary tokens encoded as bytes, compared with the same tokens in base64
+    // as text, at error correction level M.
+    static constexpr string_view Base64 = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    
+    printf("ticks are %s\n", bench::tickUnit());
+    printf("%6s %6s %14s %6s %14s\n", "bytes", "width", "encodeBytes", "width", "base64");
+    for (size_t length : { 64, 256, 1024 }) {
+        vector<uint8_t> token(length);
+        for (size_t i = 0; i < length; ++i) { token[i] = uint8_t((i * 2654435761u) >> 24); }
+        string base64;
+        for (size_t i = 0; i < length; i += 3) {
+            const uint32_t group = token[i] << 16 | (i + 1 < length ? token[i + 1] << 8 : 0)
+                                 | (i + 2 < length ? token[i + 2] : 0);
+            for (size_t j = 0; j < 4; ++j) {
+                base64.push_back(i + j <= length ? Base64[(group >> (18 - 6 * j)) & 63] : '=');
+            }
+        }
+        
+        const double bytes = bench::measure([&]() {
+            bench::doNotOptimize(QR::encodeBytes(token));
+        }, 10, 5);
+        const double text = bench::measure([&]() {
+            bench::doNotOptimize(QR::encode(base64));
+        }, 10, 5);
+        printf("%6zu %6zu %14.0f %6zu %14.0f\n", length, QR::encodeBytes(token).size(), bytes,
+               QR::encode(base64).size(), text);
+    }
+}
+
+
+BENCHMARK(QR_finalSequence) {
+    // Error correction and interleaving of the data codewords of a version.
+    printf("ticks are %s\n", bench::tickUnit());
+    printf("%7s %10s %14s\n", "version", "codewords", "finalSequence");
+    
+    for (uint8_t version = 1; version <= 40; version += version < 10 ? 3 : 10) {
+        Data bits;
+        for (size_t i = 0; i < QR::dataBitsCounts[version - 1][QRGen_EC_M] / 8; ++i) {
+            bits.append(8, uint32_t(i * 2654435761u) >> 24);
+        }
+        vector<uint8_t> sequence(QR::interleaving(version, QRGen_EC_M).size());
+        const double ticks = bench::measure([&]() {
+            QR::finalSequence(bits, version, QRGen_EC_M, sequence);
+            bench::doNotOptimize(sequence);
+        }, 10, 5);
+        printf("%7u %10zu %14.0f\n", version, sequence.size(), ticks);
+    }
+}
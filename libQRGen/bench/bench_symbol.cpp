@@ -0,0 +1,162 @@
+// Copyright 2024 Benjamin Lutz.
+// 
+// This file is part of QRGen. QRGen is free software: you can redistribute it
+// and/or modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include "bench.h"
+#define private public
+#include "../src/symbol.h"
+
+using namespace std;
+
+
+/**
+ * The memory held by \a symbol, in bytes, including the object itself but
+ * not the template it shares with all symbols of its version.
+ */
+static size_t memoryUsage(const Symbol &symbol) {
+    return sizeof(Symbol) + symbol._modules.capacity() * sizeof(uint64_t)
+        + symbol._pixelType.capacity() * sizeof(Symbol::PixelType)
+        + symbol._highlight.capacity() * sizeof(uint32_t);
+}
+
+
+BENCHMARK(Symbol_setData) {
+    printf("ticks are %s\n", bench::tickUnit());
+    printf("%7s %7s %8s %14s %14s %14s\n", "version", "modules", "bytes", "bytes/module",
+           "construction", "setData");
+    
+    for (uint8_t version = 1; version <= 40; ++version) {
+        const Symbol symbol(version);
+        const size_t moduleCount = symbol.size() * symbol.size();
+        vector<uint8_t> data(moduleCount / 8);
+        for (size_t i = 0; i < data.size(); ++i) { data[i] = i * 167 + 13; }
+        
+        const double construction = bench::measure([&]() {
+            Symbol s(version);
+            bench::doNotOptimize(s);
+        }, 10, 3);
+        Symbol s(version);
+        const double setData = bench::measure([&]() {
+            s.setData(data, QRGen_EC_M);
+            bench::doNotOptimize(s);
+        }, 1, 3);
+        const size_t bytes = memoryUsage(symbol);
+        printf("%7u %7zu %8zu %14.3f %14.0f %14.0f\n", version, moduleCount, bytes,
+               double(bytes) / moduleCount, construction, setData);
+    }
+}
+
+
+BENCHMARK(Symbol_evaluate) {
+    // The penalty rules of a masked symbol, per method. N3 is scored with
+    // the compatible and the strict finder penalty rule.
+    using FinderPenalty = Symbol::FinderPenalty;
+    
+    printf("ticks are %s\n", bench::tickUnit());
+    printf("%7s  %-10s %10s %10s %10s %10s %10s\n", "version", "method", "N1", "N2", "N3", "N3 strict", "N4");
+    
+    for (uint8_t version = 1; version <= 40; version += version < 10 ? 3 : 10) {
+        Symbol symbol(version);
+        vector<uint8_t> data(symbol.size() * symbol.size() / 8);
+        for (size_t i = 0; i < data.size(); ++i) { data[i] = i * 167 + 13; }
+        symbol.setData(data, QRGen_EC_M, 0);
+        
+        const double n4 = bench::measure([&]() { bench::doNotOptimize(symbol.evaluateDarkProportion()); });
+        
+        const double n1Reference = bench::measure([&]() { bench::doNotOptimize(symbol.evaluateAdjacentSameColor()); });
+        const double n2Reference = bench::measure([&]() { bench::doNotOptimize(symbol.evaluateSameColorBlocks()); });
+        const double n3Reference = bench::measure([&]() {
+            bench::doNotOptimize(symbol.evaluate11311Pattern(FinderPenalty::Compatible));
+        }, 1, 3);
+        const double n3StrictReference = bench::measure([&]() {
+            bench::doNotOptimize(symbol.evaluate11311Pattern(FinderPenalty::Strict));
+        }, 10, 3);
+        printf("%7u  %-10s %10.0f %10.0f %10.0f %10.0f %10.0f\n", version, "Reference",
+               n1Reference, n2Reference, n3Reference, n3StrictReference, n4);
+        
+        const Symbol::ModulePlane columns = symbol.transposed();
+        const double n1Bitboard = bench::measure([&]() {
+            bench::doNotOptimize(symbol.evaluateAdjacentSameColorBitboard(columns));
+        });
+        const double n2Bitboard = bench::measure([&]() {
+            bench::doNotOptimize(symbol.evaluateSameColorBlocksBitboard());
+        });
+        const double n3Bitboard = bench::measure([&]() {
+            bench::doNotOptimize(symbol.evaluate11311PatternRunLength(columns, FinderPenalty::Compatible));
+        });
+        const double n3StrictBitboard = bench::measure([&]() {
+            bench::doNotOptimize(symbol.evaluate11311PatternRunLength(columns, FinderPenalty::Strict));
+        });
+        printf("%7u  %-10s %10.0f %10.0f %10.0f %10.0f %10.0f\n", version, "Bitboard",
+               n1Bitboard, n2Bitboard, n3Bitboard, n3StrictBitboard, n4);
+    }
+}
+
+
+BENCHMARK(Symbol_selectMask) {
+    // setData() choosing among all eight masks, per penalty method. Pruned
+    // is the share of masks abandoned early with the Bitboard method.
+    using PenaltyMethod = Symbol::PenaltyMethod;
+    
+    printf("ticks are %s\n", bench::tickUnit());
+    printf("%7s %14s %14s %10s\n", "version", "Bitboard", "BitSliced", "pruned");
+    
+    for (uint8_t version = 1; version <= 40; version += version < 10 ? 3 : 10) {
+        Symbol symbol(version);
+        vector<uint8_t> data(symbol.size() * symbol.size() / 8);
+        for (size_t i = 0; i < data.size(); ++i) { data[i] = uint32_t(i * 2654435761u) >> 24; }
+        
+        Symbol::resetMaskStatistics();
+        const double bitboard = bench::measure([&]() {
+            symbol.setData(data, QRGen_EC_M, 255, {.penaltyMethod = PenaltyMethod::Bitboard});
+            bench::doNotOptimize(symbol);
+        }, 1, 3);
+        const Symbol::MaskStatistics statistics = Symbol::maskStatistics();
+        uint64_t pruned = 0;
+        for (uint64_t count : statistics.pruned) { pruned += count; }
+        
+        const double bitSliced = bench::measure([&]() {
+            symbol.setData(data, QRGen_EC_M, 255, {.penaltyMethod = PenaltyMethod::BitSliced});
+            bench::doNotOptimize(symbol);
+        }, 1, 3);
+        printf("%7u %14.0f %14.0f %9.0f%%\n", version, bitboard, bitSliced,
+               100.0 * pruned / (8 * statistics.selections));
+    }
+}
+
+
+BENCHMARK(Symbol_maskPolicy) {
+    // setData() per mask selection policy, with the masks evaluated. The
+    // deadline budget is 100 µs.
+    using namespace std::chrono_literals;
+    
+    printf("ticks are %s\n", bench::tickUnit());
+    printf("%7s %14s %14s %14s %10s\n", "version", "Exhaustive", "Heuristic", "Deadline", "evaluated");
+    
+    for (uint8_t version = 1; version <= 40; version += version < 10 ? 3 : 10) {
+        Symbol symbol(version);
+        vector<uint8_t> data(symbol.size() * symbol.size() / 8);
+        for (size_t i = 0; i < data.size(); ++i) { data[i] = uint32_t(i * 2654435761u) >> 24; }
+        
+        const double exhaustive = bench::measure([&]() {
+            symbol.setData(data, QRGen_EC_M, 255, {.selection = QRGen_Mask_Exhaustive});
+            bench::doNotOptimize(symbol);
+        }, 1, 3);
+        const double heuristic = bench::measure([&]() {
+            symbol.setData(data, QRGen_EC_M, 255, {.selection = QRGen_Mask_Heuristic});
+            bench::doNotOptimize(symbol);
+        }, 1, 3);
+        const double deadline = bench::measure([&]() {
+            symbol.setData(data, QRGen_EC_M, 255, {.selection = QRGen_Mask_Deadline, .budget = 100us});
+            bench::doNotOptimize(symbol);
+        }, 1, 3);
+        printf("%7u %14.0f %14.0f %14.0f %10u\n", version, exhaustive, heuristic, deadline,
+               unsigned(symbol.maskReport().masksEvaluated));
+    }
+}
@@ -14,6 +14,7 @@ extern "C" {
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 
 #if defined(_WIN32)
@@ -34,6 +35,56 @@ extern "C" {
 enum QRGen_ErrorCorrection { QRGen_EC_L = 0, QRGen_EC_M = 1, QRGen_EC_Q = 2, QRGen_EC_H = 3 };
 
 
+/**
+ * How the data mask of a QR code is selected. Any mask gives a valid QR code,
+ * the best one (with the lowest penalty score) is the easiest to read.
+ */
+enum QRGen_MaskSelection {
+    /** Score all 8 masks and use the best one. The default. */
+    QRGen_Mask_Exhaustive = 0,
+    /**
+     * Estimate the scores from the cheaper penalty rules, leaving out
+     * finder-like patterns, and use the best mask by that estimate.
+     */
+    QRGen_Mask_Heuristic = 1,
+    /**
+     * Same as QRGen_Mask_Exhaustive, but once the time budget has run out,
+     * use the best mask so far. The first mask is always scored.
+     */
+    QRGen_Mask_Deadline = 2
+};
+
+
+/** Selects the data mask, see QRGen_encode_policy(). */
+struct QRGen_MaskPolicy {
+    enum QRGen_MaskSelection selection;
+    unsigned int budgetMicroseconds; ///< The time mask selection may take with QRGen_Mask_Deadline
+};
+
+
+/** Reports how the data mask was selected, see QRGen_encode_policy(). */
+struct QRGen_MaskReport {
+    /**
+     * The selection which determined the mask: QRGen_Mask_Heuristic with
+     * that policy, QRGen_Mask_Deadline with that policy if the budget ran
+     * out, and QRGen_Mask_Exhaustive otherwise, including when the deadline
+     * policy scored all masks in time.
+     */
+    enum QRGen_MaskSelection selection;
+    int mask;                   ///< The mask used, 0-7
+    int masksEvaluated;         ///< The number of masks scored or ruled out
+    double elapsedMicroseconds; ///< The time spent on mask selection
+};
+
+
+/**
+ * The largest width (and height) a QR code can have, which is that of a
+ * version 40 symbol. A buffer of QRGEN_MAX_WIDTH * QRGEN_MAX_WIDTH bools is
+ * large enough for any QR code.
+ */
+#define QRGEN_MAX_WIDTH 177
+
+
 /**
  * Contains a QR Code.
  */
@@ -58,6 +109,11 @@ struct QRGen_Symbol {
  *   - use best mask
  *   - use smallest version possible.
  *   
+ * Runs of digits, alphanumeric and kanji characters are encoded in the modes
+ * for them where that is shorter. Text containing other characters outside of
+ * ISO 8859-1 is encoded as UTF-8, with an ECI header designating UTF-8.
+ * \a data must be valid UTF-8.
+ * 
  * A pointer to a QRGen_Symbol struct is returned. It's width and height are
  * is non-zero on success, and are both 0 if the QR code could not be created.
  * 
@@ -79,6 +135,74 @@ struct QRGen_Symbol *QRGen_encode(const char *data, size_t len) QRGEN_EXPORT;
 struct QRGen_Symbol *QRGen_encode_ec(const char *data, size_t len, QRGen_ErrorCorrection ec) QRGEN_EXPORT;
 
 
+/**
+ * Create a QR code from the binary \a data, using error correction level
+ * \a ec. The bytes are encoded as they are, in byte mode, so \a data need
+ * not be text, and bytes which are not valid UTF-8 are allowed. Readers
+ * usually present such a QR code's content as ISO 8859-1 text.
+ * 
+ * The returned symbol must be deallocated using QRGen_free_symbol().
+ * 
+ * @param data   the bytes to encode
+ * @param len    the number of bytes in \a data, at most 2953
+ * @param ec     the error correction level
+ * @return the QR Code, or \c NULL if it could not be created.
+ */
+struct QRGen_Symbol *QRGen_encode_bytes(const uint8_t *data, size_t len, QRGen_ErrorCorrection ec) QRGEN_EXPORT;
+
+
+/**
+ * Same as QRGen_encode_ec(), but writes the QR code into \a symbol instead of
+ * allocating a new QRGen_Symbol. No memory is allocated, apart from the tables
+ * of a version and error correction level, which are built by the first call
+ * which needs them and then shared by all threads. This makes this function
+ * suitable for encoding many QR codes in a row.
+ * 
+ * \a symbol->data must point to a buffer of at least \a capacity bools. This
+ * can be a buffer owned by the caller, or the data of a symbol previously
+ * returned by QRGen_encode(), in which case \a capacity is that symbol's
+ * width * height. A capacity of QRGEN_MAX_WIDTH * QRGEN_MAX_WIDTH is always
+ * sufficient.
+ * 
+ * On success, \a symbol's width and height are set, and the first
+ * width * height elements of its data are overwritten. If the QR code could
+ * not be created or does not fit into \a capacity, width and height are set
+ * to 0 and the data is left untouched.
+ * 
+ * @param data      an UTF-8-encoded string
+ * @param len       the number of bytes in \a data.
+ * @param ec        the error correction level
+ * @param symbol    the symbol which receives the QR code
+ * @param capacity  the number of elements in \a symbol->data
+ * @return \c true on success, \c false otherwise.
+ */
+bool QRGen_encode_into(const char *data, size_t len, QRGen_ErrorCorrection ec,
+                       struct QRGen_Symbol *symbol, size_t capacity) QRGEN_EXPORT;
+
+
+/**
+ * Same as QRGen_encode_into(), but selects the data mask according to
+ * \a policy. If \a policy is \c NULL, all masks are scored, as with the other
+ * functions. If \a report is not \c NULL, it receives how the mask was
+ * selected and the time spent doing so.
+ * 
+ * With QRGen_Mask_Deadline, the budget is checked between penalty rules, so
+ * it may be exceeded by the time it takes to score a single rule.
+ * 
+ * @param data      an UTF-8-encoded string
+ * @param len       the number of bytes in \a data.
+ * @param ec        the error correction level
+ * @param policy    how to select the mask, or \c NULL
+ * @param report    receives how the mask was selected, or \c NULL
+ * @param symbol    the symbol which receives the QR code
+ * @param capacity  the number of elements in \a symbol->data
+ * @return \c true on success, \c false otherwise.
+ */
+bool QRGen_encode_policy(const char *data, size_t len, QRGen_ErrorCorrection ec,
+                         const struct QRGen_MaskPolicy *policy, struct QRGen_MaskReport *report,
+                         struct QRGen_Symbol *symbol, size_t capacity) QRGEN_EXPORT;
+
+
 /** Free the memory used by \a symbol. */
 void QRGen_free_symbol(QRGen_Symbol *symbol) QRGEN_EXPORT;
 
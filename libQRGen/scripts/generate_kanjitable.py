@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+# Copyright 2024 Benjamin Lutz.
+#
+# This file is part of QRGen. QRGen is free software: you can redistribute it
+# and/or modify it under the terms of the GNU General Public License as
+# published by the Free Software Foundation, either version 3 of the License,
+# or (at your option) any later version.
+
+"""Generates src/kanjitable.h, the Unicode to QR kanji mode lookup table.
+
+QR kanji mode encodes the double byte Shift JIS (JIS X 0208) characters in
+the ranges 0x8140-0x9FFC and 0xE040-0xEBBF as 13 bit values, see section 7.4.6
+of ISO/IEC 18004:2015. The table maps the Basic Multilingual Plane to these
+values in two levels: the code point's upper 9 bits select a block of 128
+entries, which its lower 7 bits index. Blocks without kanji characters share
+block 0, so the table takes about 47 KiB instead of 128 KiB.
+
+Usage: scripts/generate_kanjitable.py > src/kanjitable.h
+"""
+
+BLOCK_BITS = 7
+BLOCK_SIZE = 1 << BLOCK_BITS
+NONE = 0xFFFF
+
+
+def kanji_value(code_point):
+    """The 13 bit kanji mode value of code_point, or None."""
+    if 0xD800 <= code_point <= 0xDFFF:
+        return None
+    try:
+        encoded = chr(code_point).encode('shift_jis')
+    except UnicodeEncodeError:
+        return None
+    if len(encoded) != 2:
+        return None
+    shift_jis = encoded[0] << 8 | encoded[1]
+    if 0x8140 <= shift_jis <= 0x9FFC:
+        value = shift_jis - 0x8140
+    elif 0xE040 <= shift_jis <= 0xEBBF:
+        value = shift_jis - 0xC140
+    else:
+        return None
+    return (value >> 8) * 0xC0 + (value & 0xFF)
+
+
+def main():
+    blocks = [(NONE,) * BLOCK_SIZE]
+    index = []
+    for start in range(0, 0x10000, BLOCK_SIZE):
+        block = tuple(kanji_value(c) if kanji_value(c) is not None else NONE
+                      for c in range(start, start + BLOCK_SIZE))
+        if block not in blocks:
+            blocks.append(block)
+        index.append(blocks.index(block))
+    assert len(blocks) <= 256
+
+    print('''// Copyright 2024 Benjamin Lutz.
+// 
+// This file is part of QRGen. QRGen is free software: you can redistribute it
+// and/or modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+
+// Generated by scripts/generate_kanjitable.py, do not edit.
+
+#ifndef KANJITABLE_H
+#define KANJITABLE_H
+
+#include <array>
+#include <cstdint>
+
+
+/** The bits of a code point which index a block of kanjiBlocks. */
+inline constexpr unsigned int KanjiBlockBits = %d;
+
+/** The value of kanjiBlocks entries for characters without a kanji value. */
+inline constexpr uint16_t NoKanji = 0x%X;
+
+/** The block of each %d code points of the Basic Multilingual Plane. */
+inline constexpr std::array<uint8_t, %d> kanjiBlockIndex {{''' % (BLOCK_BITS, NONE, BLOCK_SIZE, len(index)))
+    for i in range(0, len(index), 16):
+        print('    ' + ' '.join('%d,' % b for b in index[i:i + 16]))
+    print('''}};
+
+/** The 13 bit kanji mode values, or NoKanji, per block. */
+inline constexpr std::array<std::array<uint16_t, %d>, %d> kanjiBlocks {{''' % (BLOCK_SIZE, len(blocks)))
+    for number, block in enumerate(blocks):
+        print('    {{ // block %d' % number)
+        for i in range(0, BLOCK_SIZE, 16):
+            print('        ' + ' '.join('0x%04X,' % v for v in block[i:i + 16]))
+        print('    }},')
+    print('''}};
+
+
+/** The kanji mode value of \\a c, or -1 if it has none. */
+inline constexpr int kanjiValue(char32_t c) {
+    if (c > 0xFFFF) { return -1; }
+    const uint16_t value = kanjiBlocks[kanjiBlockIndex[c >> KanjiBlockBits]][c & ((1 << KanjiBlockBits) - 1)];
+    return value == NoKanji ? -1 : value;
+}
+
+#endif // KANJITABLE_H''')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,28 @@
+// Copyright 2024 Benjamin Lutz.
+// 
+// This file is part of QRGen. QRGen is free software: you can redistribute it
+// and/or modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+
+#include "cpu.h"
+
+
+bool CPU::hasSSSE3() {
+#ifdef QRGEN_X86_SIMD
+    static const bool result = __builtin_cpu_supports("ssse3");
+    return result;
+#else
+    return false;
+#endif
+}
+
+
+bool CPU::hasGFNI() {
+#ifdef QRGEN_X86_SIMD
+    static const bool result = __builtin_cpu_supports("gfni") && __builtin_cpu_supports("ssse3");
+    return result;
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,32 @@
+// Copyright 2024 Benjamin Lutz.
+// 
+// This file is part of QRGen. QRGen is free software: you can redistribute it
+// and/or modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+
+#ifndef CPU_H
+#define CPU_H
+
+// Defined if SIMD code paths for x86 can be compiled. They are compiled with
+// function-specific target attributes, and must only be called after checking
+// the required features with CPU at runtime.
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define QRGEN_X86_SIMD
+#endif
+
+
+/**
+ * Runtime detection of the CPU features used by SIMD code paths. All
+ * functions return \c false on platforms without SIMD code paths.
+ */
+class CPU
+{
+public:
+    CPU() = delete;
+    
+    static bool hasSSSE3(); ///< Whether PSHUFB and PALIGNR are available.
+    static bool hasGFNI();  ///< Whether GF2P8AFFINEQB is available (SSE encoding).
+};
+
+#endif // CPU_H
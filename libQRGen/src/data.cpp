@@ -7,82 +7,99 @@
 
 #include "data.h"
 #include <algorithm>
+#include <bit>
 #include <cassert>
+#include <cstring>
+#include <stdexcept>
 
 using namespace std;
 
-Data::Data() : _bitCount{0} {}
+static_assert(sizeof(Data::T) == 1, "the accumulator works on bytes");
 
 
-Data::Data(std::initializer_list<T> list) : _d{list}, _bitCount{list.size() * TBitSize} {}
+/** Loads the 8 bytes at \a p as a big endian word. */
+static inline uint64_t loadBigEndian(const uint8_t *p) {
+    uint64_t result;
+    if constexpr (endian::native == endian::little) {
+        memcpy(&result, p, sizeof(result));
+        result = __builtin_bswap64(result);
+    } else if constexpr (endian::native == endian::big) {
+        memcpy(&result, p, sizeof(result));
+    } else {
+        result = 0;
+        for (size_t i = 0; i < 8; ++i) { result = (result << 8) | p[i]; }
+    }
+    return result;
+}
+
+
+/** Stores \a word at \a p, as loadBigEndian() loads it. */
+static inline void storeBigEndian(uint8_t *p, uint64_t word) {
+    if constexpr (endian::native == endian::little) {
+        word = __builtin_bswap64(word);
+        memcpy(p, &word, sizeof(word));
+    } else if constexpr (endian::native == endian::big) {
+        memcpy(p, &word, sizeof(word));
+    } else {
+        for (size_t i = 0; i < 8; ++i) { p[i] = uint8_t(word >> (56 - 8 * i)); }
+    }
+}
+
+
+Data::Data() : _d{}, _bitCount{0}, _accumulator{0}, _accumulatorStart{0} {}
+
+
+Data::Data(std::initializer_list<T> list) : _d{}, _bitCount{list.size() * TBitSize} {
+    checkCapacity(_bitCount);
+    copy(list.begin(), list.end(), _d.begin());
+    loadAccumulator();
+}
+
+
+Data::T Data::at(std::size_t i) const {
+    if (i >= size()) { throw out_of_range("Data::at"); }
+    return _d[i];
+}
 
 
 void Data::append(size_t bits, uint32_t value) {
     static constexpr size_t valueBitSize = 8 * sizeof(value);
     
     if (bits > valueBitSize) {
-        const size_t numZeros = bits - sizeof(value) * 8;
-        appendZeros(numZeros);
-        bits -= numZeros;
+        appendZeros(bits - valueBitSize);
+        bits = valueBitSize;
     }
-    assert(bits <= valueBitSize);
     
     if (bits < valueBitSize) {
         const uint32_t mask = (uint32_t{1} << bits) - uint32_t{1};
         value &= mask;
     }
-    
-    if ((_bitCount & TBitMask) != 0) {
-        const size_t used = _bitCount & TBitMask;
-        const size_t remaining = TBitSize - used;
-        const size_t bitsToInsert = min(remaining, bits);
-        const uint32_t valueBits = value >> (bits - bitsToInsert);
-        _d.back() |= valueBits << (remaining - bitsToInsert);
-        bits -= bitsToInsert;
-        _bitCount += bitsToInsert;
-    }
-    
-    assert((_bitCount & TBitMask) == 0 || bits == 0);
-    
-    while (bits >= TBitSize) {
-        _d.push_back(value >> (bits - TBitSize));
-        bits -= TBitSize;
-        _bitCount += TBitSize;
-    }
-    
-    if (bits > 0) {
-        _d.push_back(value << (TBitSize - bits));
-        _bitCount += bits;
-    }
+    appendWord(bits, value);
 }
 
 
 void Data::append(const Data &other) {
-    // save the values, so if a Data is appended to itself, they don't change
-    // during this function.
-    const size_t otherSize = other.size();
-    const size_t otherBitCount = other.bitCount();
-    
-    const size_t otherWholeElements = otherBitCount / TBitSize;
-    for (size_t i = 0; i < otherWholeElements; ++i) {
-        append(TBitSize, other.at(i));
-    }
-    
-    const size_t remaining = otherBitCount & TBitMask;
-    if (remaining > 0) {
-        append(remaining, other.at(otherSize - 1) >> (TBitSize - remaining));
-    }
+    // pass the bit count by value, so if a Data is appended to itself, it
+    // doesn't change while appending
+    appendBits(other._d.data(), other.bitCount());
+}
+
+
+void Data::append(std::span<const T> bytes) {
+    appendBits(bytes.data(), bytes.size() * TBitSize);
 }
 
 
 void Data::clear() {
-    _d.clear();
+    fill(_d.begin(), _d.begin() + size(), 0);
     _bitCount = 0;
+    _accumulator = 0;
+    _accumulatorStart = 0;
 }
 
 
 void Data::padLastByte() {
-    const size_t zeroCount = TBitSize - (_bitCount & TBitMask);
+    const size_t zeroCount = (TBitSize - (_bitCount & TBitMask)) & TBitMask;
     if (zeroCount != 0) {
         appendZeros(zeroCount);
     }
@@ -90,12 +107,86 @@ void Data::padLastByte() {
 
 
 bool Data::operator==(const Data &other) const {
-    return _bitCount == other._bitCount && _d == other._d;
+    return _bitCount == other._bitCount && equal(_d.begin(), _d.begin() + size(), other._d.begin());
 }
 
 
 void Data::appendZeros(std::size_t count) {
+    checkCapacity(_bitCount + count);
     _bitCount += count;
-    const size_t newSize = (_bitCount + TBitSize - 1) / TBitSize;
-    _d.resize(newSize);
+    loadAccumulator();
+}
+
+
+/**
+ * Appends the first \a bitCount bits of \a source, of which the bits past
+ * them in the last byte must be 0. No bytes are read past that byte.
+ */
+void Data::appendBits(const T *source, std::size_t bitCount) {
+    if (bitCount == 0) { return; }
+    checkCapacity(_bitCount + bitCount);
+    
+    if ((_bitCount & TBitMask) == 0) {
+        memcpy(&_d[_bitCount / TBitSize], source, (bitCount + TBitMask) / TBitSize);
+        _bitCount += bitCount;
+        loadAccumulator();
+        return;
+    }
+    
+    // The source words are read from whole bytes, which appendWord() only
+    // changes past the source's bits, if this is the source.
+    static constexpr size_t ChunkBits = 56;
+    size_t i = 0;
+    for (; i + 64 <= bitCount; i += ChunkBits) {
+        appendWord(ChunkBits, loadBigEndian(source + i / TBitSize) >> (64 - ChunkBits));
+    }
+    
+    // the last up to 63 bits, from a copy of the remaining bytes
+    size_t remaining = bitCount - i;
+    T tail[sizeof(uint64_t)] = {};
+    memcpy(tail, source + i / TBitSize, (remaining + TBitMask) / TBitSize);
+    uint64_t word = loadBigEndian(tail);
+    if (remaining > ChunkBits) {
+        appendWord(ChunkBits, word >> (64 - ChunkBits));
+        word <<= ChunkBits;
+        remaining -= ChunkBits;
+    }
+    if (remaining > 0) {
+        appendWord(remaining, word >> (64 - remaining));
+    }
+}
+
+
+// At most 56 bits can be appended at once, since the accumulator keeps up to
+// 7 used bits when it drops its whole bytes.
+void Data::appendWord(std::size_t bits, uint64_t value) {
+    assert(bits <= 56 && value >> bits == 0);
+    if (bits == 0) { return; }
+    
+    size_t used = _bitCount - _accumulatorStart * TBitSize;
+    if (used + bits >= 64) {
+        // the whole bytes are stored already
+        const size_t dropped = used / TBitSize;
+        _accumulator <<= dropped * TBitSize;
+        _accumulatorStart += dropped;
+        used -= dropped * TBitSize;
+    }
+    checkCapacity(_bitCount + bits);
+    
+    _accumulator |= value << (64 - used - bits);
+    storeBigEndian(&_d[_accumulatorStart], _accumulator);
+    _bitCount += bits;
+}
+
+
+/** Throws std::length_error if \a bitCount bits exceed the capacity. */
+void Data::checkCapacity(std::size_t bitCount) const {
+    if (bitCount > Capacity * TBitSize) { throw length_error("Data: capacity exceeded"); }
+}
+
+
+/** Restarts the accumulator at the byte holding the next free bit, after the storage was written directly. */
+void Data::loadAccumulator() {
+    _accumulatorStart = _bitCount / TBitSize;
+    _accumulator = loadBigEndian(&_d[_accumulatorStart]);
 }
@@ -8,25 +8,41 @@
 #ifndef DATA_H
 #define DATA_H
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <initializer_list>
-#include <vector>
+#include <span>
 
 
 /**
  * A container class to which bits can be appended, but which can also work with
  * byte-wise access.
+ * 
+ * Bits are appended to a 64 bit accumulator, which holds the 8 bytes of the
+ * storage from the byte holding the next free bit or a few bytes before it.
+ * New bits are shifted into the accumulator, which is then stored back with
+ * one 64 bit write, without reading the storage; only when it is full, it
+ * drops its leading whole bytes. The storage therefore always extends 8 bytes
+ * past the last data byte, and all bits past the data are 0.
+ * 
+ * The storage is part of the object and holds up to Capacity elements, the
+ * codewords of the largest QR code, so a Data object never allocates memory.
+ * Appending beyond that throws std::length_error.
  */
 class Data {
 public:
     using T = uint8_t;
     
+    /** The number of T elements a Data object can hold: the codewords of a version 40 symbol. */
+    static constexpr std::size_t Capacity = 3706;
+    
     Data(); ///< Creates an empty data object.
     
     /** Creates a data object filled with the elements of \a list. */
     Data(std::initializer_list<T> list);
     
-    const std::vector<T> &data() const; ///< The bits collected into units of type T.
+    std::span<const T> data() const; ///< The bits collected into units of type T.
     T at(std::size_t i) const; ///< Access the i-th data element (as T, not bits).
     
     std::size_t bitCount() const; ///< The number of bits stored.
@@ -41,7 +57,18 @@ public:
      * @param value  the value containing the bits
      */
     void append(size_t bits, uint32_t value);
-    void append(const Data &other); ///< Append the contens of another data object.
+    /**
+     * Append the contents of another data object: with memcpy if this one
+     * ends on a byte boundary, otherwise shifted into place 56 bits at a
+     * time.
+     */
+    void append(const Data &other);
+    void append(std::span<const T> bytes); ///< Append \a bytes, like another data object.
+    /**
+     * Append the \a bits least significant bits of \a value, like append(),
+     * for up to 56 bits at once. \a value must be 0 above them.
+     */
+    void appendWord(std::size_t bits, uint64_t value);
     
     void clear(); ///< Remove all data from this Data object, setting size and bitCount to 0.
     
@@ -51,19 +78,24 @@ public:
     
 private:
     void appendZeros(std::size_t count);
+    void appendBits(const T *source, std::size_t bitCount);
+    void checkCapacity(std::size_t bitCount) const;
+    void loadAccumulator();
     
     static constexpr size_t TBitSize = 8 * sizeof(T);
     static constexpr size_t TBitMask = TBitSize - 1;
+    static constexpr size_t AccumulatorSize = sizeof(uint64_t);
     
     // bit order: high bit of low byte comes first, low bit of high byte last
-    std::vector<T> _d;
+    std::array<T, Capacity + AccumulatorSize> _d;
     std::size_t _bitCount;
+    uint64_t _accumulator; ///< _d[_accumulatorStart] to _d[_accumulatorStart + 7], big endian
+    std::size_t _accumulatorStart; ///< at most _bitCount / 8, and at least (_bitCount - 63) / 8
 };
 
 
-inline const std::vector<Data::T> &Data::data() const { return _d; }
-inline Data::T Data::at(std::size_t i) const { return _d.at(i); }
+inline std::span<const Data::T> Data::data() const { return { _d.data(), size() }; }
 inline std::size_t Data::bitCount() const { return _bitCount; }
-inline std::size_t Data::size() const { return _d.size(); }
+inline std::size_t Data::size() const { return (_bitCount + TBitMask) / TBitSize; }
 
 #endif // DATA_H
@@ -7,134 +7,392 @@
 
 #include "ecccalculator.h"
 #include <algorithm>
+#include <array>
 #include <bit>
-#include <iostream>
+#include <cassert>
+#include <cstring>
 #include <iterator>
-#include <map>
+#include "cpu.h"
+#ifdef QRGEN_X86_SIMD
+#include <immintrin.h>
+#endif
 
 using namespace std;
 
 
-ECCCalculator::ECCCalculator(size_t eccCount)
-    : _b(eccCount, GFQR::zero()), _g(eccCount) {
-    const vector<uint8_t> &gp = generatorPolynomial(eccCount);
-    transform(gp.begin(), gp.end(), _g.begin(), &GFQR::alpha);
+using GeneratorPolynomials = array<array<uint8_t, ECCCalculator::MaxDegree>,
+                                   ECCCalculator::MaxDegree + 1>;
+
+
+/**
+ * Calculate the generator polynomials for all degrees up to
+ * ECCCalculator::MaxDegree. The generator polynomial of degree n is the
+ * product of the first degree polynomials:
+ * 
+ *     x - α⁰, x - α¹, ..., x - αⁿ⁻¹
+ * 
+ * It is built up one factor at a time, using the polynomial of degree n - 1:
+ * 
+ *     gₙ(x) = gₙ₋₁(x) · (x - αⁿ⁻¹)
+ * 
+ * Compare the results with Annex A of ISO/IEC 18004:2015.
+ */
+static constexpr GeneratorPolynomials calculateGeneratorPolynomials() {
+    using GFQR = GF256<GF256_RP::QR>;
+    constexpr uint8_t alpha = 2; // the primitive element for the QR reducing polynomial
+    
+    GeneratorPolynomials result{};
+    // the coefficients of the current polynomial, including the leading 1.
+    array<uint8_t, ECCCalculator::MaxDegree + 1> polynomial{1};
+    uint8_t alphaPower = 1; // αⁿ⁻¹
+    
+    for (size_t degree = 1; degree <= ECCCalculator::MaxDegree; ++degree) {
+        // multiply by x, then add the polynomial multiplied by αⁿ⁻¹
+        for (size_t i = degree; i > 0; --i) {
+            polynomial[i] = polynomial[i - 1] ^ GFQR::mulPeasant(polynomial[i], alphaPower);
+        }
+        polynomial[0] = GFQR::mulPeasant(polynomial[0], alphaPower);
+        
+        for (size_t i = 0; i < degree; ++i) {
+            result[degree][i] = polynomial[i];
+        }
+        alphaPower = GFQR::mulPeasant(alphaPower, alpha);
+    }
+    
+    return result;
 }
 
 
-void ECCCalculator::reset() {
-    fill(_b.begin(), _b.end(), GFQR::zero());
+/** Generator polynomials as GF-elements, indexed by degree. */
+static constexpr GeneratorPolynomials generatorPolynomials = calculateGeneratorPolynomials();
+
+
+/** The numbers of error correction codewords per block used by QR codes. */
+static constexpr array<size_t, 13> tableDegrees = {7, 10, 13, 15, 16, 17, 18, 20, 22, 24, 26, 28, 30};
+
+using FeedbackTable = array<array<uint8_t, 32>, 256>;
+
+
+/**
+ * Calculate the tables for ECCCalculator::Method::Table. Row c of a table is
+ * the product c·g(x) of the generator polynomial g(x), ordered like the
+ * remainder register, i.e. starting with the coefficient of xⁿ⁻¹. Unused
+ * entries are 0.
+ */
+static constexpr array<FeedbackTable, tableDegrees.size()> calculateFeedbackTables() {
+    using GFQR = GF256<GF256_RP::QR>;
+    
+    array<FeedbackTable, tableDegrees.size()> result{};
+    for (size_t t = 0; t < tableDegrees.size(); ++t) {
+        const size_t degree = tableDegrees[t];
+        const array<uint8_t, ECCCalculator::MaxDegree> &g = generatorPolynomials[degree];
+        for (size_t c = 0; c < 256; ++c) {
+            for (size_t j = 0; j < degree; ++j) {
+                result[t][c][j] = GFQR::mulPeasant(c, g[degree - 1 - j]);
+            }
+        }
+    }
+    return result;
 }
 
 
-void ECCCalculator::feed(uint8_t value) {
-    const GFQR::Element lastRegister = _b[0];
-    const GFQR::Element polyInput = lastRegister + GFQR::Element{value};
-    for (size_t i = _b.size(); i-- > 0;) {
-        GFQR::Element x = polyInput * _g[i];
-        _b[_b.size() - i - 1] = x + (i > 0 ? _b[_b.size() - i] : GFQR::zero());
+static constexpr array<FeedbackTable, tableDegrees.size()> feedbackTables = calculateFeedbackTables();
+
+
+#ifdef QRGEN_X86_SIMD
+/**
+ * Calculate the tables for ECCCalculator::Method::SSSE3. Row c contains the
+ * products of c with all values of a low nibble (0x00-0x0F), followed by the
+ * products of c with all values of a high nibble (0x00, 0x10, ..., 0xF0).
+ */
+static constexpr array<array<uint8_t, 32>, 256> calculateNibbleTables() {
+    using GFQR = GF256<GF256_RP::QR>;
+    
+    array<array<uint8_t, 32>, 256> result{};
+    for (size_t c = 0; c < 256; ++c) {
+        for (size_t n = 0; n < 16; ++n) {
+            result[c][n] = GFQR::mulPeasant(c, n);
+            result[c][16 + n] = GFQR::mulPeasant(c, n << 4);
+        }
     }
+    return result;
 }
 
 
-vector<uint8_t> ECCCalculator::errorCodeWords() const {
-    vector<uint8_t> result;
-    copy(_b.begin(), _b.end(), back_inserter(result));
+/**
+ * Calculate the tables for ECCCalculator::Method::GFNI. Entry c is the 8x8 bit
+ * matrix of the multiplication by c, in the layout used by GF2P8AFFINEQB:
+ * byte 7 - i selects the input bits which are summed up into output bit i.
+ */
+static constexpr array<uint64_t, 256> calculateAffineMatrices() {
+    using GFQR = GF256<GF256_RP::QR>;
+    
+    array<uint64_t, 256> result{};
+    for (size_t c = 0; c < 256; ++c) {
+        for (size_t k = 0; k < 8; ++k) {
+            const uint8_t column = GFQR::mulPeasant(c, 1 << k); // c·xᵏ
+            for (size_t i = 0; i < 8; ++i) {
+                if (column & (1 << i)) { result[c] |= uint64_t{1} << (8 * (7 - i) + k); }
+            }
+        }
+    }
     return result;
 }
 
 
-const vector<uint8_t> &ECCCalculator::generatorPolynomial(size_t degree) {
-    // Precalculated polynomials, since calculating these may take some time,
-    // especially for the higher degrees, which can take minutes.
-    // Compare with Annex A of ISO/IEC 18004:2015.
-    // These values are powers of alpha.
-    // 
-    // Note: it would be more efficient to store GF-elements rather than powers
-    // of alpha, since only GF-elements are actually used in calculations.
-    static map<size_t, vector<uint8_t>> polynomials = {
-        { 16, { 120, 225, 194, 182, 169, 147, 191, 91, 3, 76, 161, 102, 109, 107, 104, 120, }},
-        { 17, { 136, 163, 243, 39, 150, 99, 24, 147, 214, 206, 123, 239, 43, 78, 206, 139, 43, }},
-        { 22, { 231, 165, 105, 160, 134, 219, 80, 98, 172, 8, 74, 200, 53, 221, 109, 14, 230, 93, 242, 247, 171, 210, }},
-        { 24, { 20, 156, 215, 248, 132, 200, 241, 111, 218, 228, 226, 192, 152, 169, 180, 159, 126, 251, 117, 211, 48, 135, 121, 229, }},
-        { 26, { 69, 217, 144, 40, 31, 171, 183, 15, 20, 96, 243, 201, 166, 165, 28, 111, 201, 145, 17, 118, 182, 103, 2, 158, 125, 173, }},
-        { 28, { 122, 8, 36, 241, 118, 165, 25, 42, 244, 106, 133, 199, 89, 14, 125, 183, 47, 195, 190, 110, 180, 108, 234, 224, 104, 200, 223, 168, }},
-        { 30, { 179, 191, 39, 237, 215, 250, 36, 208, 182, 90, 152, 62, 216, 152, 175, 159, 1, 129, 178, 46, 48, 50, 182, 179, 31, 216, 152, 145, 173, 41, }},
-    };
+alignas(16) static constexpr array<array<uint8_t, 32>, 256> nibbleTables = calculateNibbleTables();
+static constexpr array<uint64_t, 256> affineMatrices = calculateAffineMatrices();
+
+
+// The SIMD methods hold the 32 byte register in two vectors. Shifting it by
+// one codeword means shifting bytes from the second vector into the first.
+
+__attribute__((target("ssse3")))
+static void feedSSSE3(uint8_t *reg, const uint8_t *gr, const uint8_t *begin, const uint8_t *end) {
+    const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+    const __m128i g0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(gr));
+    const __m128i g1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(gr + 16));
+    const __m128i g0Low = _mm_and_si128(g0, nibbleMask);
+    const __m128i g0High = _mm_and_si128(_mm_srli_epi16(g0, 4), nibbleMask);
+    const __m128i g1Low = _mm_and_si128(g1, nibbleMask);
+    const __m128i g1High = _mm_and_si128(_mm_srli_epi16(g1, 4), nibbleMask);
     
-    if (polynomials.find(degree) == polynomials.end()) {
-        polynomials.insert({degree, calculateGeneratorPolynomial(degree)});
+    __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(reg));
+    __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(reg + 16));
+    for (const uint8_t *it = begin; it != end; ++it) {
+        const uint8_t c = uint8_t(_mm_cvtsi128_si32(b0)) ^ *it;
+        const __m128i low = _mm_load_si128(reinterpret_cast<const __m128i*>(nibbleTables[c].data()));
+        const __m128i high = _mm_load_si128(reinterpret_cast<const __m128i*>(nibbleTables[c].data() + 16));
+        const __m128i p0 = _mm_xor_si128(_mm_shuffle_epi8(low, g0Low), _mm_shuffle_epi8(high, g0High));
+        const __m128i p1 = _mm_xor_si128(_mm_shuffle_epi8(low, g1Low), _mm_shuffle_epi8(high, g1High));
+        b0 = _mm_xor_si128(_mm_alignr_epi8(b1, b0, 1), p0);
+        b1 = _mm_xor_si128(_mm_srli_si128(b1, 1), p1);
     }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(reg), b0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(reg + 16), b1);
+}
+
+
+__attribute__((target("gfni,ssse3")))
+static void feedGFNI(uint8_t *reg, const uint8_t *gr, const uint8_t *begin, const uint8_t *end) {
+    const __m128i g0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(gr));
+    const __m128i g1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(gr + 16));
     
-    return polynomials[degree];
+    __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(reg));
+    __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(reg + 16));
+    for (const uint8_t *it = begin; it != end; ++it) {
+        const uint8_t c = uint8_t(_mm_cvtsi128_si32(b0)) ^ *it;
+        const __m128i matrix = _mm_set1_epi64x(affineMatrices[c]);
+        const __m128i p0 = _mm_gf2p8affine_epi64_epi8(g0, matrix, 0);
+        const __m128i p1 = _mm_gf2p8affine_epi64_epi8(g1, matrix, 0);
+        b0 = _mm_xor_si128(_mm_alignr_epi8(b1, b0, 1), p0);
+        b1 = _mm_xor_si128(_mm_srli_si128(b1, 1), p1);
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(reg), b0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(reg + 16), b1);
 }
 
 
-/**
- * Generate the code for the cached polynomials in generatorPolynomial(size_t).
- */
-void ECCCalculator::generatorPolynomialCache() {
-    cout << "static map<size_t, vector<uint8_t>> polynomials = {" << endl;
+// The batched SIMD methods hold the remainder registers of up to 16 blocks in
+// b[0..degree), one vector per register position and one lane per block. The
+// feedback codewords c of all lanes are multiplied with a generator
+// coefficient at once. b[degree] stays 0 and is shifted into b[degree - 1].
+
+static void gatherLanes(uint8_t *lanes, const uint8_t *const *blocks, size_t laneCount, size_t i) {
+    for (size_t lane = 0; lane < laneCount; ++lane) { lanes[lane] = blocks[lane][i]; }
+}
+
+
+static void scatterLanes(uint8_t *const *remainders, const __m128i *b, size_t laneCount, size_t degree) {
+    alignas(16) uint8_t lanes[16];
+    for (size_t j = 0; j < degree; ++j) {
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), b[j]);
+        for (size_t lane = 0; lane < laneCount; ++lane) { remainders[lane][j] = lanes[lane]; }
+    }
+}
+
+
+__attribute__((target("ssse3")))
+static void feedBlocksSSSE3(const uint8_t *const *blocks, uint8_t *const *remainders,
+                            size_t laneCount, size_t dataCount, const uint8_t *gr, size_t degree) {
+    const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+    __m128i low[ECCCalculator::MaxDegree];
+    __m128i high[ECCCalculator::MaxDegree];
+    for (size_t j = 0; j < degree; ++j) {
+        low[j] = _mm_load_si128(reinterpret_cast<const __m128i*>(nibbleTables[gr[j]].data()));
+        high[j] = _mm_load_si128(reinterpret_cast<const __m128i*>(nibbleTables[gr[j]].data() + 16));
+    }
     
-    for (size_t degree : { 16, 17, 22, 24, 26, 28, 30 }) {
-        cout << "\t{ " << degree << ", { ";
-        
-        const vector<uint8_t> gp = generatorPolynomial(degree);
-        for (uint8_t x : gp) {
-            cout << unsigned{x} << ", ";
+    __m128i b[ECCCalculator::MaxDegree + 1];
+    fill_n(b, degree + 1, _mm_setzero_si128());
+    alignas(16) uint8_t lanes[16] = {};
+    for (size_t i = 0; i < dataCount; ++i) {
+        gatherLanes(lanes, blocks, laneCount, i);
+        const __m128i c = _mm_xor_si128(b[0], _mm_load_si128(reinterpret_cast<const __m128i*>(lanes)));
+        const __m128i cLow = _mm_and_si128(c, nibbleMask);
+        const __m128i cHigh = _mm_and_si128(_mm_srli_epi16(c, 4), nibbleMask);
+        for (size_t j = 0; j < degree; ++j) {
+            const __m128i p = _mm_xor_si128(_mm_shuffle_epi8(low[j], cLow), _mm_shuffle_epi8(high[j], cHigh));
+            b[j] = _mm_xor_si128(b[j + 1], p);
         }
-        
-        cout << "}}," << endl;
     }
-    
-    cout << "};" << endl;
+    scatterLanes(remainders, b, laneCount, degree);
 }
 
 
-/**
- * Calculate the product of the first degree polynomials:
- * 
- *     x - α⁰, x - α¹, ..., x - αⁿ⁻¹
- * 
- * where n is the degree.
- * 
- * The runtime of this function scales exponentially with the degree, so at
- * degree 20 or above, it starts becoming slow. Calculating the polynomial
- * with degree 30 takes several minutes at the time of writing.
- */
-vector<uint8_t> ECCCalculator::calculateGeneratorPolynomial(size_t degree) {
-    vector<GFQR::Element> polynomial(degree);
+__attribute__((target("gfni,ssse3")))
+static void feedBlocksGFNI(const uint8_t *const *blocks, uint8_t *const *remainders,
+                           size_t laneCount, size_t dataCount, const uint8_t *gr, size_t degree) {
+    __m128i matrices[ECCCalculator::MaxDegree];
+    for (size_t j = 0; j < degree; ++j) { matrices[j] = _mm_set1_epi64x(affineMatrices[gr[j]]); }
     
-    for (size_t i = 0; i < (1U << degree); ++i) {
-        // Algorithm: for each polynomial, the product first degree
-        // polynomials is expanded into a sum of products:
-        // 
-        //   (x - α²)(x - α¹)(x - α⁰)                                   (A)
-        // = xxx-xxα⁰ - xα¹x + xα¹α⁰ - α²xx + α²xα⁰ + α²α¹x - α²α¹α⁰    (B)
-        //   000 001    010    011    100     101     110     111       (C)
-        //
-        // So the summands of (B) can be enumerated with a counter i (C),
-        // where each bit of selects a summand of each term in (A). If the
-        // bit is 0, the x is chosen, otherwise an α is chosen.
-        //
-        // The degree of each summand of (B) is determined by the number
-        // of 0s in i, this is saved as k.
-        //
-        // Since all coefficients are powers of α, We can sum up the
-        // exponents.
-        const size_t k = degree - popcount(i);
-        uint8_t exponent = 0;
+    __m128i b[ECCCalculator::MaxDegree + 1];
+    fill_n(b, degree + 1, _mm_setzero_si128());
+    alignas(16) uint8_t lanes[16] = {};
+    for (size_t i = 0; i < dataCount; ++i) {
+        gatherLanes(lanes, blocks, laneCount, i);
+        const __m128i c = _mm_xor_si128(b[0], _mm_load_si128(reinterpret_cast<const __m128i*>(lanes)));
         for (size_t j = 0; j < degree; ++j) {
-            if (i & (1 << j)) {
-                exponent += j;
-            }
+            b[j] = _mm_xor_si128(b[j + 1], _mm_gf2p8affine_epi64_epi8(c, matrices[j], 0));
         }
-        polynomial[k] = polynomial[k] + GFQR::alpha(exponent);
     }
+    scatterLanes(remainders, b, laneCount, degree);
+}
+#endif // QRGEN_X86_SIMD
+
+
+ECCCalculator::ECCCalculator(size_t eccCount, Method method)
+    : _degree(eccCount), _method(supportedMethod(method, eccCount)),
+      _g(generatorPolynomial(eccCount)), _table(feedbackTable(eccCount)), _gr{}, _b{} {
+    static_assert(is_same_v<FeedbackTable::value_type, Register>);
+    static_assert(RegisterSize >= MaxDegree && RegisterSize % sizeof(uint64_t) == 0);
     
-    // Finally convert the results to α-exponents.
-    vector<uint8_t> result;
-    result.reserve(polynomial.size());
-    transform(polynomial.begin(), polynomial.end(), back_inserter(result), &GFQR::logAlpha);
-    return result;
+    for (size_t i = 0; i < _degree; ++i) { _gr[i] = _g[_degree - 1 - i]; }
+}
+
+
+void ECCCalculator::reset() {
+    _b.fill(0);
+}
+
+
+void ECCCalculator::feed(uint8_t value) {
+    feed(&value, &value + 1);
+}
+
+
+void ECCCalculator::feed(const uint8_t *begin, const uint8_t *end) {
+    switch (_method) {
+    case Method::Reference: feedReference(begin, end); break;
+    case Method::Table: feedTable(begin, end); break;
+#ifdef QRGEN_X86_SIMD
+    case Method::SSSE3: feedSSSE3(_b.data(), _gr.data(), begin, end); break;
+    case Method::GFNI: feedGFNI(_b.data(), _gr.data(), begin, end); break;
+#endif
+    default: assert(false);
+    }
+}
+
+
+vector<uint8_t> ECCCalculator::errorCodeWords() const {
+    return vector<uint8_t>(_b.begin(), _b.begin() + _degree);
+}
+
+
+void ECCCalculator::feedBlocks(const uint8_t *const *blocks, uint8_t *const *remainders,
+                               size_t blockCount, size_t dataCount, size_t eccCount, Method method) {
+    ECCCalculator eccc{eccCount, method};
+    for (size_t first = 0; first < blockCount; first += BatchLanes) {
+        const size_t laneCount = min(BatchLanes, blockCount - first);
+        const uint8_t *const *laneBlocks = blocks + first;
+        uint8_t *const *laneRemainders = remainders + first;
+        
+        // A batch step costs about as much as feeding BatchLanes / 2 codewords
+        // into a single register, so a few remaining blocks are fed one by one.
+        if (laneCount >= BatchLanes / 2) {
+#ifdef QRGEN_X86_SIMD
+            if (eccc._method == Method::GFNI) {
+                feedBlocksGFNI(laneBlocks, laneRemainders, laneCount, dataCount, eccc._gr.data(), eccCount);
+                continue;
+            }
+            if (eccc._method == Method::SSSE3) {
+                feedBlocksSSSE3(laneBlocks, laneRemainders, laneCount, dataCount, eccc._gr.data(), eccCount);
+                continue;
+            }
+#endif
+        }
+        
+        for (size_t lane = 0; lane < laneCount; ++lane) {
+            eccc.reset();
+            eccc.feed(laneBlocks[lane], laneBlocks[lane] + dataCount);
+            copy_n(eccc._b.begin(), eccCount, laneRemainders[lane]);
+        }
+    }
+}
+
+
+span<const uint8_t> ECCCalculator::generatorPolynomial(size_t degree) {
+    assert(degree <= MaxDegree);
+    return span<const uint8_t>(generatorPolynomials[degree].data(), degree);
+}
+
+
+const ECCCalculator::Register *ECCCalculator::feedbackTable(size_t degree) {
+    for (size_t t = 0; t < tableDegrees.size(); ++t) {
+        if (tableDegrees[t] == degree) {
+            return feedbackTables[t].data();
+        }
+    }
+    return nullptr;
+}
+
+
+ECCCalculator::Method ECCCalculator::supportedMethod(Method method, size_t degree) {
+    if (method == Method::Best) { method = Method::GFNI; }
+    if (method == Method::GFNI && !CPU::hasGFNI()) { method = Method::SSSE3; }
+    if (method == Method::SSSE3 && !CPU::hasSSSE3()) { method = Method::Table; }
+    if (method == Method::Table && feedbackTable(degree) == nullptr) { method = Method::Reference; }
+    return method;
+}
+
+
+void ECCCalculator::feedReference(const uint8_t *begin, const uint8_t *end) {
+    for (const uint8_t *it = begin; it != end; ++it) {
+        const GFQR::Element lastRegister = _b[0];
+        const GFQR::Element polyInput = lastRegister + GFQR::Element{*it};
+        for (size_t i = _degree; i-- > 0;) {
+            GFQR::Element x = polyInput * GFQR::Element{_g[i]};
+            _b[_degree - i - 1] = x + (i > 0 ? GFQR::Element{_b[_degree - i]} : GFQR::zero());
+        }
+    }
+}
+
+
+void ECCCalculator::feedTable(const uint8_t *begin, const uint8_t *end) {
+    // Like a table-driven CRC: the feedback codeword selects a row, which is
+    // added to the register after shifting it by one codeword. The register
+    // entries past the degree are always 0, so they shift in zeros.
+    if constexpr (endian::native == endian::little) {
+        // Only the words covering the degree need to be updated, since the
+        // row entries past the degree are 0, too.
+        static constexpr size_t WordCount = RegisterSize / sizeof(uint64_t);
+        const size_t wordCount = (_degree + sizeof(uint64_t)) / sizeof(uint64_t);
+        uint64_t b[WordCount];
+        memcpy(b, _b.data(), RegisterSize);
+        for (const uint8_t *it = begin; it != end; ++it) {
+            uint64_t r[WordCount];
+            memcpy(r, _table[uint8_t(b[0]) ^ *it].data(), RegisterSize);
+            for (size_t i = 0; i < wordCount; ++i) {
+                const uint64_t next = i + 1 < WordCount ? b[i + 1] : 0;
+                b[i] = ((b[i] >> 8) | (next << 56)) ^ r[i];
+            }
+        }
+        memcpy(_b.data(), b, RegisterSize);
+    } else {
+        for (const uint8_t *it = begin; it != end; ++it) {
+            const Register &row = _table[_b[0] ^ *it];
+            for (size_t i = 0; i < RegisterSize - 1; ++i) { _b[i] = _b[i + 1] ^ row[i]; }
+            _b[RegisterSize - 1] = row[RegisterSize - 1];
+        }
+    }
 }
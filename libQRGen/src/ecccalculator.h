@@ -8,7 +8,13 @@
 #ifndef ECCCALCULATOR_H
 #define ECCCALCULATOR_H
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
 #include <vector>
 #include "gf.h"
 
@@ -16,34 +22,131 @@
 /**
  * Calculates the error correction codewords as per Section 7.5.2 of
  * ISO/IEC 18004:2015.
+ * 
+ * The generator polynomials are immutable tables computed at compile time, so
+ * separate ECCCalculator objects can be used from different threads without
+ * any synchronization.
  */
 class ECCCalculator {
 public:
-    ECCCalculator(size_t eccCount);
+    /** The highest number of error correction codewords per block of any QR code. */
+    static constexpr size_t MaxDegree = 30;
+    
+    /** The number of blocks feedBlocks() processes in parallel with SIMD methods. */
+    static constexpr size_t BatchLanes = 16;
+    
+    /**
+     * How the remainder register is updated for each fed codeword. All
+     * methods produce identical results. A method which is not available for
+     * the degree or not supported by the CPU falls back to the next simpler
+     * one, in the order GFNI, SSSE3, Table, Reference.
+     */
+    enum class Method : uint8_t {
+        /** Multiply each generator coefficient in GF(256). Kept for reference. */
+        Reference,
+        /**
+         * Look up the product of the generator polynomial with the feedback
+         * codeword in a precomputed table, and add it to the shifted register
+         * a word at a time. Only available for the degrees used by QR codes.
+         */
+        Table,
+        /**
+         * Multiply the generator polynomial by the feedback codeword 16
+         * coefficients at a time, with PSHUFB lookups of the products with
+         * the low and high nibbles of the coefficients.
+         */
+        SSSE3,
+        /**
+         * Multiply the generator polynomial by the feedback codeword 16
+         * coefficients at a time, with GF2P8AFFINEQB and the bit matrix of
+         * the multiplication by the feedback codeword. (GF2P8MULB cannot be
+         * used, since it uses a different reducing polynomial.)
+         */
+        GFNI,
+        /** The fastest method supported by the CPU. */
+        Best
+    };
+    
+    ECCCalculator(size_t eccCount, Method method = Method::Best);
+    
+    Method method() const; ///< The method actually used, after falling back.
     
     void reset();
     void feed(uint8_t value);
+    void feed(const uint8_t *begin, const uint8_t *end); ///< Feed a range of codewords.
     std::vector<uint8_t> errorCodeWords() const;
     
     template <typename It>
     static std::vector<uint8_t> feed(It begin, It end, size_t eccCount);
     
+    /**
+     * Calculates the error correction codewords of \a blockCount blocks in one
+     * pass. All blocks must have \a dataCount data codewords and get
+     * \a eccCount error correction codewords, as is the case within a group
+     * of blocks of a symbol, or across symbols of the same version and error
+     * correction level.
+     * 
+     * With the SIMD methods, BatchLanes blocks are processed in parallel, one
+     * block per vector lane: the remainder registers are stored interleaved,
+     * one vector per coefficient, so the feedback codewords of all lanes are
+     * multiplied with a generator coefficient at once. Other methods process
+     * the blocks one after another.
+     * 
+     * @param blocks pointers to the data codewords of each block
+     * @param remainders pointers to where each block's error correction
+     *        codewords are written
+     */
+    static void feedBlocks(const uint8_t *const *blocks, uint8_t *const *remainders,
+                           size_t blockCount, size_t dataCount, size_t eccCount,
+                           Method method = Method::Best);
+    
 private:
     using GFQR = GF256<GF256_RP::QR>;
     
-    static const std::vector<uint8_t> &generatorPolynomial(size_t degree);
-    static void generatorPolynomialCache();
-    static std::vector<uint8_t> calculateGeneratorPolynomial(size_t degree);
-
-    std::vector<GFQR::Element> _b;
-    std::vector<GFQR::Element> _g;
+    /** The size of the register and of the feedback table rows, in bytes. */
+    static constexpr size_t RegisterSize = 32;
+    using Register = std::array<uint8_t, RegisterSize>;
+    
+    /**
+     * The generator polynomial of the given \a degree, as GF-elements. Element
+     * i is the coefficient of xⁱ; the coefficient of xⁿ is always 1 and not
+     * included. \a degree must be at most MaxDegree.
+     */
+    static std::span<const uint8_t> generatorPolynomial(size_t degree);
+    
+    /**
+     * The table for Method::Table, or \c nullptr if there is none for
+     * \a degree. Row c contains the generator polynomial multiplied by c, in
+     * register order (highest order coefficient first).
+     */
+    static const Register *feedbackTable(size_t degree);
+    
+    static Method supportedMethod(Method method, size_t degree);
+    
+    void feedReference(const uint8_t *begin, const uint8_t *end);
+    void feedTable(const uint8_t *begin, const uint8_t *end);
+    
+    size_t _degree;
+    Method _method;
+    std::span<const uint8_t> _g;
+    const Register *_table;
+    Register _gr; ///< The generator polynomial in register order.
+    Register _b; ///< The remainder register, highest order coefficient first.
 };
 
 
+inline ECCCalculator::Method ECCCalculator::method() const { return _method; }
+
+
 template<typename It>
 std::vector<uint8_t> ECCCalculator::feed(It begin, It end, size_t eccCount) {
     ECCCalculator eccc{eccCount};
-    for (It it = begin; it != end; ++it) { eccc.feed(*it); }
+    if constexpr (std::contiguous_iterator<It>
+                  && std::is_same_v<std::iter_value_t<It>, uint8_t>) {
+        eccc.feed(std::to_address(begin), std::to_address(end));
+    } else {
+        for (It it = begin; it != end; ++it) { eccc.feed(*it); }
+    }
     return eccc.errorCodeWords();
 }
 
@@ -11,7 +11,6 @@
 #include <array>
 #include <cassert>
 #include <cstdint>
-#include <map>
 #include <utility>
 
 
@@ -49,14 +48,14 @@ public:
      */
     class Element {
     public:
-        Element(uint8_t value = 0);
+        constexpr Element(uint8_t value = 0);
         
         Element operator+(const Element &other) const;
         Element operator-(const Element &other) const;
         Element operator*(const Element &other) const;
         Element operator/(const Element &other) const;
         bool operator==(const Element &other) const;
-        operator uint8_t() const;
+        constexpr operator uint8_t() const;
         operator int() const;
         
     private:
@@ -65,15 +64,20 @@ public:
     
     GF256() = delete;
     
-    static Element zero(); ///< Returns the identity element for addition.
-    static Element one();  ///< Returns the identity element for multiplication.
+    static constexpr Element zero(); ///< Returns the identity element for addition.
+    static constexpr Element one();  ///< Returns the identity element for multiplication.
     static Element alpha(int n = 1); ///< Returns α^n.
     
     static uint8_t logAlpha(Element e); ///< Returns log_alpha(value)
     
+    /**
+     * Multiplies \a a and \a b without using lookup tables. This is slower
+     * than multiplying Elements, but can be used in constant expressions.
+     */
+    static constexpr uint8_t mulPeasant(uint8_t a, uint8_t b);
+    
 private:
     static uint8_t mulLong(uint8_t a, uint8_t b);
-    static uint8_t mulPeasant(uint8_t a, uint8_t b);
     static uint8_t mulLookup(uint8_t a, uint8_t b);
     
     struct AlphaTables {
@@ -81,14 +85,16 @@ private:
         std::array<uint8_t, 256> log;
     };
     
-    static AlphaTables generateAlphaTables();
+    static constexpr AlphaTables generateAlphaTables();
     
+    // Initialized at compile time, so it can be read from any thread at any
+    // time, including during static initialization.
     static const AlphaTables _alphaTables;
 };
 
 
 template <GF256_RP RP>
-GF256<RP>::Element::Element(uint8_t value) : _value(value) {}
+constexpr GF256<RP>::Element::Element(uint8_t value) : _value(value) {}
 
 
 template <GF256_RP RP>
@@ -123,7 +129,7 @@ bool GF256<RP>::Element::operator==(const Element &other) const {
 
 
 template <GF256_RP RP>
-GF256<RP>::Element::operator uint8_t() const {
+constexpr GF256<RP>::Element::operator uint8_t() const {
     return _value;
 }
 
@@ -135,21 +141,24 @@ GF256<RP>::Element::operator int() const {
 
 
 template <GF256_RP RP>
-typename GF256<RP>::AlphaTables GF256<RP>::generateAlphaTables() {
-    // This map contains all reducing polynomials over GF(256) and the corresponding
-    // smallest primitive elements.
-    static const std::map<uint8_t, uint8_t> GF256RPs{
+constexpr typename GF256<RP>::AlphaTables GF256<RP>::generateAlphaTables() {
+    // This table contains all reducing polynomials over GF(256) and the
+    // corresponding smallest primitive elements.
+    constexpr std::array<std::pair<uint8_t, uint8_t>, 30> GF256RPs{{
         {0x1B, 3}, {0x1D, 2}, {0x2B, 2}, {0x2D, 2}, {0x39, 3}, {0x3F, 3}, {0x4D, 2}, {0x5F, 2},
         {0x63, 2}, {0x65, 2}, {0x69, 2}, {0x71, 2}, {0x77, 3}, {0x7B, 9}, {0x87, 2}, {0x8B, 6},
         {0x8D, 2}, {0x9F, 3}, {0xA3, 3}, {0xA9, 2}, {0xB1, 6}, {0xBD, 7}, {0xC3, 2}, {0xCF, 2},
         {0xD7, 7}, {0xDD, 6}, {0xE7, 2}, {0xF3, 6}, {0xF5, 2}, {0xF9, 3}
-    };
-    assert(GF256RPs.find(static_cast<std::underlying_type<GF256_RP>::type>(RP)) != GF256RPs.end());
+    }};
+    
+    uint8_t alpha = 0;
+    for (const auto &[rp, primitiveElement] : GF256RPs) {
+        if (rp == static_cast<std::underlying_type<GF256_RP>::type>(RP)) { alpha = primitiveElement; }
+    }
+    assert(alpha != 0);
     
-    AlphaTables result;
-    Element alpha{GF256RPs.find(static_cast<std::underlying_type<GF256_RP>::type>(RP))->second};
+    AlphaTables result{};
     result.pow[0] = one();
-    result.log.fill(0);
     for (std::size_t i = 1; i < result.pow.size(); ++i) {
         GF256<RP>::Element value{mulPeasant(result.pow[i - 1], alpha)};
         result.pow[i] = value;
@@ -161,13 +170,13 @@ typename GF256<RP>::AlphaTables GF256<RP>::generateAlphaTables() {
 
 
 template<GF256_RP RP>
-typename GF256<RP>::Element GF256<RP>::zero() {
+constexpr typename GF256<RP>::Element GF256<RP>::zero() {
     return 0;
 }
 
 
 template<GF256_RP RP>
-typename GF256<RP>::Element GF256<RP>::one() {
+constexpr typename GF256<RP>::Element GF256<RP>::one() {
     return 1;
 }
 
@@ -209,7 +218,7 @@ uint8_t GF256<RP>::mulLong(uint8_t a, uint8_t b) {
 
 
 template<GF256_RP RP>
-uint8_t GF256<RP>::mulPeasant(uint8_t a, uint8_t b) {
+constexpr uint8_t GF256<RP>::mulPeasant(uint8_t a, uint8_t b) {
     uint8_t result = 0;
     
     for (int i = 0; i <= 8; ++i) {
@@ -225,7 +234,7 @@ uint8_t GF256<RP>::mulPeasant(uint8_t a, uint8_t b) {
 
 template<GF256_RP RP>
 uint8_t GF256<RP>::mulLookup(uint8_t a, uint8_t b) {
-    uint8_t mask = a | b ? 0xFF : 0x00;
+    uint8_t mask = a && b ? 0xFF : 0x00;
     uint16_t a_powerOf2 = _alphaTables.log[a];
     uint16_t b_powerOf2 = _alphaTables.log[b];
     uint8_t c = (a_powerOf2 + b_powerOf2) % 255;
@@ -235,6 +244,6 @@ uint8_t GF256<RP>::mulLookup(uint8_t a, uint8_t b) {
 
 
 template <GF256_RP RP>
-const typename GF256<RP>::AlphaTables GF256<RP>::_alphaTables{GF256<RP>::generateAlphaTables()};
+constinit const typename GF256<RP>::AlphaTables GF256<RP>::_alphaTables{GF256<RP>::generateAlphaTables()};
 
 #endif // GF_H
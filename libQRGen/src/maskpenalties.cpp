@@ -0,0 +1,224 @@
+// Copyright 2024 Benjamin Lutz.
+// 
+// This file is part of QRGen. QRGen is free software: you can redistribute it
+// and/or modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+
+#include "maskpenalties.h"
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+
+using namespace std;
+
+
+// penalty weights, table 11 of ISO/IEC 18004:2015
+static constexpr unsigned int N1 = 3;
+static constexpr unsigned int N2 = 3;
+static constexpr unsigned int N3 = 40;
+static constexpr unsigned int N4 = 10;
+
+static constexpr uint64_t LaneBits = 0x0101'0101'0101'0101u; ///< bit 0 of each byte
+
+
+/** Loads the 8 bytes at \a p, byte i at bits 8i to 8i+7 regardless of endianness. */
+static inline uint64_t load(const uint8_t *p) {
+    uint64_t result;
+    if constexpr (endian::native == endian::little) {
+        memcpy(&result, p, sizeof(result));
+    } else {
+        result = 0;
+        for (size_t i = 0; i < 8; ++i) { result |= uint64_t(p[i]) << (8 * i); }
+    }
+    return result;
+}
+
+
+/** Stores \a word at \a p, as load() loads it. */
+static inline void store(uint8_t *p, uint64_t word) {
+    if constexpr (endian::native == endian::little) {
+        memcpy(p, &word, sizeof(word));
+    } else {
+        for (size_t i = 0; i < 8; ++i) { p[i] = uint8_t(word >> (8 * i)); }
+    }
+}
+
+
+/** The bytes of a word for which the position is < \a count, with \a count >= 0. */
+static inline uint64_t firstBytes(ptrdiff_t count) {
+    return count >= 8 ? ~uint64_t{0} : (uint64_t{1} << (8 * count)) - 1;
+}
+
+
+/** Adds \a weight times the number of bytes of \a word with bit k set to scores[k]. */
+static inline void addLanes(MaskPenalties::Scores &scores, uint64_t word, unsigned int weight) {
+    if (word == 0) { return; }
+    for (size_t k = 0; k < 8; ++k) {
+        scores[k] += weight * popcount(word & (LaneBits << k));
+    }
+}
+
+
+/**
+ * Transposes the 8x8 bit matrix \a x, whose byte i is row i and bit j of a
+ * byte column j.
+ */
+static inline uint64_t transpose8(uint64_t x) {
+    x = (x & 0xAA55'AA55'AA55'AA55u) | ((x & 0x00AA'00AA'00AA'00AAu) << 7) | ((x >> 7) & 0x00AA'00AA'00AA'00AAu);
+    x = (x & 0xCCCC'3333'CCCC'3333u) | ((x & 0x0000'CCCC'0000'CCCCu) << 14) | ((x >> 14) & 0x0000'CCCC'0000'CCCCu);
+    x = (x & 0xF0F0'F0F0'0F0F'0F0Fu) | ((x & 0x0000'0000'F0F0'F0F0u) << 28) | ((x >> 28) & 0x0000'0000'F0F0'F0F0u);
+    return x;
+}
+
+
+MaskPenalties::Scores MaskPenalties::evaluate(const Planes &planes, size_t size,
+                                              Symbol::FinderPenalty finderPenalty) {
+    assert(size + 2 * Border + 32 <= Line::Capacity);
+    
+    vector<Line> rows(size);
+    vector<Line> columns(size);
+    slice(planes, size, rows);
+    transpose(rows, size, columns);
+    
+    Scores scores{};
+    for (size_t i = 0; i < size; ++i) {
+        addRuns(scores, rows[i], size);
+        addRuns(scores, columns[i], size);
+        if (i + 1 < size) { addBlocks(scores, rows[i], rows[i + 1], size); }
+        addFinderPatterns(scores, rows[i], size, i, finderPenalty);
+        addFinderPatterns(scores, columns[i], size, i, finderPenalty);
+    }
+    
+    // N4, as in Symbol::evaluateDarkProportion()
+    for (size_t k = 0; k < 8; ++k) {
+        size_t darkCount = 0;
+        for (uint64_t word : planes[k]) { darkCount += popcount(word); }
+        int darkProportion = 20 * darkCount / (size * size) - 10;
+        if (2 * darkCount < size * size) { darkProportion += 1; }
+        scores[k] += abs(darkProportion) * N4;
+    }
+    return scores;
+}
+
+
+/**
+ * Converts the planes into bit-sliced rows. Each group of 8 modules is sliced
+ * with a transposition of the 8x8 bit matrix of their bits in the 8 planes.
+ */
+void MaskPenalties::slice(const Planes &planes, size_t size, vector<Line> &rows) {
+    const size_t stride = (size + 63) / 64;
+    for (size_t y = 0; y < size; ++y) {
+        Line &row = rows[y];
+        row.modules.fill(0);
+        for (size_t x = 0; x < size; x += 8) {
+            uint64_t bits = 0; // byte k: the 8 modules with mask k
+            for (size_t k = 0; k < 8; ++k) {
+                const uint64_t word = planes[k][y * stride + x / 64];
+                bits |= ((word >> (x % 64)) & 0xFF) << (8 * k);
+            }
+            bits = transpose8(bits); // byte j: module x + j with all masks
+            for (size_t j = 0; j < 8 && x + j < size; ++j) {
+                row.modules[Border + x + j] = uint8_t(bits >> (8 * j));
+            }
+        }
+    }
+}
+
+
+void MaskPenalties::transpose(const vector<Line> &rows, size_t size, vector<Line> &columns) {
+    for (size_t x = 0; x < size; ++x) { columns[x].modules.fill(0); }
+    for (size_t y = 0; y < size; ++y) {
+        const uint8_t *row = rows[y].at(0);
+        for (size_t x = 0; x < size; ++x) {
+            columns[x].modules[Border + y] = row[x];
+        }
+    }
+}
+
+
+/**
+ * N1: A run of length L >= 5 scores N1 + L - 5 = (L - 4) + 2 for N1 = 3,
+ * which is the number of 5 module windows of a single color within it, plus 2
+ * for the window at its start (see Symbol::evaluateRuns()).
+ */
+void MaskPenalties::addRuns(Scores &scores, const Line &line, size_t size) {
+    static_assert(N1 == 3);
+    const uint8_t *m = line.at(0);
+    for (size_t x = 0; x + 4 < size; x += 8) {
+        const uint64_t m0 = load(m + x);
+        const uint64_t m1 = load(m + x + 1);
+        const uint64_t m2 = load(m + x + 2);
+        const uint64_t m3 = load(m + x + 3);
+        const uint64_t m4 = load(m + x + 4);
+        const uint64_t window = ~(m0 ^ m1) & ~(m1 ^ m2) & ~(m2 ^ m3) & ~(m3 ^ m4) & firstBytes(size - 4 - x);
+        const uint64_t runStart = (load(m + x - 1) ^ m0) | (x == 0 ? 0xFF : 0);
+        addLanes(scores, window, 1);
+        addLanes(scores, window & runStart, 2);
+    }
+}
+
+
+/** N2: 2x2 blocks of a single color, with their top left module in \a line. */
+void MaskPenalties::addBlocks(Scores &scores, const Line &line, const Line &nextLine, size_t size) {
+    const uint8_t *m = line.at(0);
+    const uint8_t *n = nextLine.at(0);
+    for (size_t x = 0; x + 1 < size; x += 8) {
+        const uint64_t m0 = load(m + x);
+        const uint64_t same = ~(m0 ^ load(m + x + 1)) & ~(m0 ^ load(n + x)) & ~(m0 ^ load(n + x + 1));
+        addLanes(scores, same & firstBytes(size - 1 - x), N2);
+    }
+}
+
+
+/**
+ * N3: Matches the finder-like pattern at every position and scale, like
+ * Symbol::evaluate11311Pattern(). Whether a range of modules is all dark or
+ * all light is looked up in sparse tables, which hold the AND and the OR of
+ * the 2^k modules starting at each position, so that a match takes a fixed
+ * number of word operations regardless of the scale.
+ */
+void MaskPenalties::addFinderPatterns(Scores &scores, const Line &line, size_t size, size_t lineNo,
+                                      Symbol::FinderPenalty finderPenalty) {
+    static constexpr size_t Levels = 6; // ranges of up to 63 modules
+    const size_t paddedSize = size + 2 * Border;
+    const size_t maxScale = finderPenalty == Symbol::FinderPenalty::Strict ? 1 : size - lineNo;
+    
+    // Range lookups read up to 16 bytes past the padded line; the tables are
+    // 0 beyond it.
+    const size_t tableSize = paddedSize + 16;
+    array<array<uint8_t, Line::Capacity>, Levels> all{}; // AND of 2^k modules
+    array<array<uint8_t, Line::Capacity>, Levels> any{}; // OR of 2^k modules
+    all[0] = line.modules;
+    any[0] = line.modules;
+    for (size_t k = 1; k < Levels; ++k) {
+        const size_t half = size_t{1} << (k - 1);
+        for (size_t p = 0; p < tableSize; p += 8) {
+            store(&all[k][p], load(&all[k - 1][p]) & load(&all[k - 1][p + half]));
+            store(&any[k][p], load(&any[k - 1][p]) | load(&any[k - 1][p + half]));
+        }
+    }
+    auto dark = [&](size_t p, size_t length) -> uint64_t {
+        const size_t k = bit_width(length) - 1;
+        return load(&all[k][p]) & load(&all[k][p + length - (size_t{1} << k)]);
+    };
+    auto light = [&](size_t p, size_t length) -> uint64_t {
+        const size_t k = bit_width(length) - 1;
+        return ~(load(&any[k][p]) | load(&any[k][p + length - (size_t{1} << k)]));
+    };
+    
+    for (size_t s = 1; 15 * s < paddedSize && s <= maxScale; ++s) {
+        assert(4 * s < (size_t{1} << Levels));
+        // p is the position of the pattern's first light module, with the
+        // line starting at 0.
+        const size_t positions = paddedSize - 15 * s + 1;
+        for (size_t p = 0; p < positions; p += 8) {
+            const uint64_t match = light(p, 4 * s) & dark(p + 4 * s, s) & light(p + 5 * s, s)
+                                 & dark(p + 6 * s, 3 * s) & light(p + 9 * s, s) & dark(p + 10 * s, s)
+                                 & light(p + 11 * s, 4 * s) & firstBytes(positions - p);
+            addLanes(scores, match, N3);
+        }
+    }
+}
@@ -0,0 +1,66 @@
+// Copyright 2024 Benjamin Lutz.
+// 
+// This file is part of QRGen. QRGen is free software: you can redistribute it
+// and/or modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+
+#ifndef MASKPENALTIES_H
+#define MASKPENALTIES_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "symbol.h"
+
+
+/**
+ * Scores the eight masked variants of a symbol in a single pass, as per
+ * section 7.8.3 of ISO/IEC 18004:2015.
+ *
+ * The variants are bit-sliced: each module is stored as a byte whose bit k is
+ * the module's color with mask k. Comparing neighbouring modules then
+ * compares them for all masks at once, and 8 modules are processed per 64
+ * bit word. The rows are processed directly, the columns on a transposed copy.
+ * Scores are identical to Symbol's penalty methods.
+ */
+class MaskPenalties {
+public:
+    MaskPenalties() = delete;
+    
+    using Scores = std::array<unsigned int, 8>;
+    using Planes = std::array<std::vector<uint64_t>, 8>;
+    
+    /**
+     * Returns the penalty scores of the module planes \a planes of a symbol
+     * with \a size modules per side. The planes have the layout of
+     * Symbol::modules().
+     */
+    static Scores evaluate(const Planes &planes, size_t size, Symbol::FinderPenalty finderPenalty);
+
+private:
+    /** Light modules before and after each line, as required by the N3 rule. */
+    static constexpr size_t Border = 4;
+    
+    /**
+     * A bit-sliced row or column: module x is at Border + x, surrounded by
+     * light modules. Long enough for word loads past the end of the line.
+     */
+    struct Line {
+        static constexpr size_t Capacity = 256;
+        alignas(8) std::array<uint8_t, Capacity> modules;
+        
+        const uint8_t *at(size_t x) const { return &modules[Border + x]; }
+    };
+    
+    static void slice(const Planes &planes, size_t size, std::vector<Line> &rows);
+    static void transpose(const std::vector<Line> &rows, size_t size, std::vector<Line> &columns);
+    
+    static void addRuns(Scores &scores, const Line &line, size_t size);
+    static void addBlocks(Scores &scores, const Line &line, const Line &nextLine, size_t size);
+    static void addFinderPatterns(Scores &scores, const Line &line, size_t size, size_t lineNo,
+                                  Symbol::FinderPenalty finderPenalty);
+};
+
+#endif // MASKPENALTIES_H
@@ -9,34 +9,50 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
-#include <functional>
+#include <cstring>
 #include <iostream>
 #include <limits>
-#include <unordered_map>
+#include <mutex>
+#include <string_view>
+#include "cpu.h"
 #include "ecccalculator.h"
+#include "kanjitable.h"
 #include "util.h"
+#ifdef QRGEN_X86_SIMD
+#include <immintrin.h>
+#endif
 
 using namespace std;
-using namespace std::placeholders;
-
-
-static bool containsKey(const unordered_map<char32_t, uint8_t> map, char32_t key);
-static unordered_map<char32_t, uint8_t> toMap(u32string_view s);
-static const unordered_map<char32_t, uint8_t> alphaNumericCharacters = toMap(
-    U"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:");
-static const unordered_map<char32_t, uint8_t> JIS_X_0201 = toMap(
-    U"∀\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0A\x0B\x0C\x0D\x0E\x0F"
-    U"\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1A\x1B\x1C\x1D\x1E\x1F"
-    U" !\"#$%^'()*+,-./0123456789:;<=>?"
-    U"@ABCDEFGHIJKLMNOPQRSTUVWXYZ[¥]^_"
-    U"`abcdefghijklmnopqrstuvwxyz{|}¯\x7F"
-    U"∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅"     // not assigned
-    U"∅｡｢｣､･ｦｧｨｩｪｫｬｭｮｯｰｱｲｳｴｵｶｷｸｹｺｻｼｽｾｿ"
-    U"ﾀﾁﾂﾃﾄﾅﾆﾇﾈﾉﾊﾋﾌﾍﾎﾏﾐﾑﾒﾓﾔﾕﾖﾗﾘﾙﾚﾛﾜﾝﾞﾟ"
-    U"∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅");   // not assigned
-static const unordered_map<char32_t, uint8_t> ISO8859_1 = toMap(
+
+
+/**
+ * A direct-index table of the characters below U+0100: the value of each
+ * character, or -1 if it is not in the table.
+ */
+using CharacterTable = array<int16_t, 256>;
+
+
+/**
+ * Creates a table from the string \a s, which lists the characters by value.
+ * ∅ marks unassigned values, ∀ the NUL character. Characters from U+0100 on
+ * are left out.
+ */
+static constexpr CharacterTable toTable(u32string_view s) {
+    CharacterTable result{};
+    result.fill(-1);
+    for (size_t i = 0; i < s.size(); ++i) {
+        if (s[i] == U'∅') { continue; }                 // skip unassigned
+        if (s[i] == U'∀') { result[U'\0'] = i; continue; } // zero
+        if (s[i] < result.size()) { result[s[i]] = i; }
+    }
+    return result;
+}
+
+
+static constexpr CharacterTable alphaNumericCharacters = toTable(U"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:");
+static constexpr CharacterTable ISO8859_1 = toTable(
     U"∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅"     // not assigned
-    U" !\"#$%^'()*+,-./0123456789:;<=>?"
+    U" !\"#$%&'()*+,-./0123456789:;<=>?"
     U"@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_"
     U"`abcdefghijklmnopqrstuvwxyz{|}~\x7F"
     U"∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅∅"     // not assigned
@@ -44,9 +60,83 @@ static const unordered_map<char32_t, uint8_t> ISO8859_1 = toMap(
     U"ÀÁÂÃÄÅÆÇÈÉÊËÌÍÎÏÐÑÒÓÔÕÖ×ØÙÚÛÜÝÞß"
     U"àáâãäåæçèéêëìíîïðñòóôõö÷øùúûüýþÿ");
 
+
+// The modes which can encode a character, as bits of characterModes. Every
+// character can be encoded as UTF-8.
+static constexpr uint8_t NumericBit = 1;
+static constexpr uint8_t AlphanumericBit = 2;
+static constexpr uint8_t EightbitBit = 4;
+static constexpr uint8_t Utf8Bit = 8;
+static constexpr uint8_t KanjiBit = 16;
+
+
+static constexpr array<uint8_t, 256> characterModes = []() {
+    array<uint8_t, 256> result{};
+    for (size_t c = 0; c < result.size(); ++c) {
+        result[c] = Utf8Bit;
+        if ('0' <= c && c <= '9') { result[c] |= NumericBit; }
+        if (alphaNumericCharacters[c] >= 0) { result[c] |= AlphanumericBit; }
+        if (ISO8859_1[c] >= 0) { result[c] |= EightbitBit; }
+        if (kanjiValue(c) >= 0) { result[c] |= KanjiBit; }
+    }
+    return result;
+}();
+
+
+/** The modes which can encode the character \a c. */
+static inline uint8_t modesOf(char32_t c) {
+    if (c < characterModes.size()) { return characterModes[c]; }
+    return kanjiValue(c) >= 0 ? Utf8Bit | KanjiBit : Utf8Bit;
+}
+
+
+/**
+ * Decodes the UTF-8 sequence starting at \a data[i], which is not ASCII, into
+ * \a c. Returns the length of the sequence, or 0 if it is malformed, overlong
+ * or a surrogate, as per table 3-7 of the Unicode standard.
+ */
+static size_t decodeUtf8(string_view data, size_t i, char32_t &c) {
+    const uint8_t lead = data[i];
+    size_t length;
+    uint8_t low = 0x80; // the range of the second byte
+    uint8_t high = 0xBF;
+    if (0xC2 <= lead && lead <= 0xDF) {
+        length = 2;
+        c = lead & 0x1F;
+    } else if (0xE0 <= lead && lead <= 0xEF) {
+        length = 3;
+        c = lead & 0x0F;
+        if (lead == 0xE0) { low = 0xA0; }
+        if (lead == 0xED) { high = 0x9F; }
+    } else if (0xF0 <= lead && lead <= 0xF4) {
+        length = 4;
+        c = lead & 0x07;
+        if (lead == 0xF0) { low = 0x90; }
+        if (lead == 0xF4) { high = 0x8F; }
+    } else {
+        return 0;
+    }
+    if (data.size() - i < length) { return 0; }
+    
+    for (size_t k = 1; k < length; ++k) {
+        const uint8_t byte = data[i + k];
+        if (byte < (k == 1 ? low : 0x80) || byte > (k == 1 ? high : 0xBF)) { return 0; }
+        c = (c << 6) | (byte & 0x3F);
+    }
+    return length;
+}
+
+
+/** Whether the 8 bytes at \a p are all ASCII. */
+static inline bool isAscii8(const char *p) {
+    uint64_t word;
+    memcpy(&word, p, sizeof(word));
+    return (word & 0x8080'8080'8080'8080u) == 0;
+}
+
 const array<array<uint16_t, 4>, 40> QR::dataBitsCounts {{
     {{152, 128, 104, 72}}, {{272, 224, 176, 128}}, {{440, 352, 272, 208}}, {{640, 512, 384, 288}}, // version 1-4
-    {{64, 688, 496, 368}}, {{1088, 864, 608, 480}}, {{1248, 992, 704, 528}}, {{1552, 1232, 880, 688}}, // version 5-8
+    {{864, 688, 496, 368}}, {{1088, 864, 608, 480}}, {{1248, 992, 704, 528}}, {{1552, 1232, 880, 688}}, // version 5-8
     {{1856, 1456, 1056, 800}}, {{2192, 1728, 1232, 976}}, {{2592, 2032, 1440, 1120}}, {{2960, 2320, 1648, 1264}}, // version 9-12
     {{3424, 2672, 1952, 1440}}, {{3688, 2920, 2088, 1576}}, {{4184, 3320, 2360, 1784}}, {{4712, 3624, 2600, 2024}}, // version 13-16
     {{5176, 4056, 2936, 2264}}, {{5768, 4504, 3176, 2504}}, {{6360, 5016, 3560, 2728}}, {{6888, 5352, 3880, 3080}}, // version 17-20
@@ -62,12 +152,12 @@ const array<array<uint16_t, 4>, 40> QR::ecCodewordsCounts {{
     {{26, 48, 72, 88}}, {{36, 64, 96, 112}}, {{40, 72, 108, 130}}, {{48, 88, 132, 156}}, // version 5-8
     {{60, 110, 160, 192}}, {{72, 130, 192, 224}}, {{80, 150, 224, 264}}, {{96, 176, 260, 308}}, // version 9-12
     {{104, 198, 288, 352}}, {{120, 216, 320, 384}}, {{132, 240, 360, 432}}, {{144, 280, 408, 480}}, // version 13-16
-    {{168, 308, 448, 532}}, {{180, 338, 504, 588}}, {{196, 384, 546, 650}}, {{224, 416, 600, 700}}, // version 17-20
+    {{168, 308, 448, 532}}, {{180, 338, 504, 588}}, {{196, 364, 546, 650}}, {{224, 416, 600, 700}}, // version 17-20
     {{224, 442, 644, 750}}, {{252, 476, 690, 816}}, {{270, 504, 750, 900}}, {{300, 560, 810, 960}}, // version 21-24
     {{312, 588, 870, 1050}}, {{336, 644, 952, 1110}}, {{360, 700, 1020, 1200}}, {{390, 728, 1050, 1260}}, // version 25-28
-    {{420, 784, 1140, 1350}}, {{450, 812, 1200, 1140}}, {{480, 868, 1290, 1530}}, {{510, 924, 1350, 1620}}, // version 29-32
+    {{420, 784, 1140, 1350}}, {{450, 812, 1200, 1440}}, {{480, 868, 1290, 1530}}, {{510, 924, 1350, 1620}}, // version 29-32
     {{540, 980, 1440, 1710}}, {{570, 1036, 1530, 1800}}, {{570, 1064, 1590, 1890}}, {{600, 1120, 1680, 1980}}, // version 33-36
-    {{630, 1204, 1770, 2100}}, {{660, 1260, 1860, 2200}}, {{720, 1316, 1950, 2310}}, {{750, 1372, 2040, 2430}} // version 37-40
+    {{630, 1204, 1770, 2100}}, {{660, 1260, 1860, 2220}}, {{720, 1316, 1950, 2310}}, {{750, 1372, 2040, 2430}} // version 37-40
 }};
 // number of error correction codes per block. Array indices have the following meanings,
 // from the outside in:
@@ -121,63 +211,397 @@ const array<array<array<array<uint16_t, 3>, 2>, 4>, 40> QR::ecBlocks {{
     {{{{{{19, 148, 118}}, {{6, 149, 119}}}}, {{{{18, 75, 47}}, {{31, 76, 48}}}}, {{{{34, 54, 24}}, {{34, 55, 25}}}}, {{{{20, 45, 15}}, {{61, 46, 16}}}}}}, // version 40
 }};
 
+const array<array<array<uint16_t, 40>, 4>, 4> QR::characterCapacities = []() {
+    static constexpr array<Mode, 4> modes = { Mode::numeric, Mode::alphanumeric, Mode::eightbit, Mode::kanji };
+    array<array<array<uint16_t, 40>, 4>, 4> result;
+    for (size_t m = 0; m < modes.size(); ++m) {
+        for (size_t ec = 0; ec < 4; ++ec) {
+            for (uint8_t version = 1; version <= 40; ++version) {
+                const uint32_t bits = dataBitsCounts[version - 1][ec] - 4 - characterCountBits(version, modes[m]);
+                uint32_t count = 0;
+                switch (modes[m]) {
+                case Mode::numeric:
+                    // 10 bits per 3 digits, 4 or 7 bits for 1 or 2 remaining ones
+                    count = bits / 10 * 3 + (bits % 10 >= 7 ? 2 : bits % 10 >= 4 ? 1 : 0);
+                    break;
+                case Mode::alphanumeric:
+                    // 11 bits per 2 characters, 6 bits for a remaining one
+                    count = bits / 11 * 2 + (bits % 11 >= 6 ? 1 : 0);
+                    break;
+                case Mode::eightbit: count = bits / 8; break;
+                case Mode::kanji: count = bits / 13; break;
+                default:;
+                }
+                result[m][ec][version - 1] = count;
+            }
+        }
+    }
+    return result;
+}();
+
 
-Symbol QR::encode(u16string_view data, QRGen_ErrorCorrection ec, uint8_t version, uint8_t mask) {
+Symbol QR::encode(string_view data, QRGen_ErrorCorrection ec, uint8_t version, uint8_t mask,
+                  const Symbol::MaskPolicy &maskPolicy, pmr::memory_resource *resource) {
     assert(version <= 40);
     assert(mask == 255 || mask < 8);
-    EncodeResult segmentResult = encodeSegment(data, ec);
-    if (!segmentResult.success) {
+    const Segmentation segmentation = segment(data, ec, max(version, uint8_t{1}));
+    if (!segmentation.success) {
         return Symbol(0); // TODO
     }
-    const uint8_t minVersion = minimumVersion(segmentResult, ec);
-    if (version < minVersion) { version = minVersion; }
     
-    // extend with padding codewords
-    bool first = true;
-    Data &bits = segmentResult.bits;
-    while (bits.bitCount() < dataBitsCounts[version - 1][to_underlying(ec)]) {
-        bits.append(8, first ? 0b11101100 : 0b00010001);
-        first = !first;
+    Data bits = encodeSegments(segmentation, ec);
+    return symbol(bits, segmentation.version, ec, mask, maskPolicy, resource);
+}
+
+
+Symbol QR::encodeBytes(span<const uint8_t> data, QRGen_ErrorCorrection ec, uint8_t version, uint8_t mask,
+                       const Symbol::MaskPolicy &maskPolicy) {
+    assert(version <= 40);
+    assert(mask == 255 || mask < 8);
+    if (data.empty()) {
+        cerr << "data is empty" << endl;
+        return Symbol(0);
+    }
+    
+    version = max(version, uint8_t{1});
+    while (version <= 40 && data.size() > characterCapacity(Mode::eightbit, ec, version)) { ++version; }
+    if (version > 40) {
+        cerr << "data is too long" << endl;
+        return Symbol(0);
     }
     
-    vector<uint8_t> codeWords = finalSequence(bits, version, ec);
-    Symbol symbol(version);
-    symbol.setData(codeWords, ec, mask);
-    return symbol;
+    // the bytes follow the 12 or 20 header bits, and are shifted into place
+    // in bulk
+    Data bits;
+    bits.append(4, to_underlying(Mode::eightbit));
+    bits.append(characterCountBits(version, Mode::eightbit), data.size());
+    bits.append(data);
+    appendTerminator(bits, version, ec);
+    return symbol(bits, version, ec, mask, maskPolicy);
 }
 
 
-QR::EncodeResult QR::encodeSegment(std::u16string_view data, QRGen_ErrorCorrection ec) {
-    static const EncodeResult failure { false, {}, Mode::terminator, 0 };
-    EncodeResult contentResult = encodeContent(data);
-    if (!contentResult.success) { return failure; }
+/**
+ * Pads \a bits, which end with the terminator, to the capacity of \a version,
+ * adds the error correction codewords and masks the symbol.
+ */
+Symbol QR::symbol(Data &bits, uint8_t version, QRGen_ErrorCorrection ec, uint8_t mask,
+                  const Symbol::MaskPolicy &maskPolicy, pmr::memory_resource *resource) {
+    appendPadding(bits, version, ec);
     
-    const uint8_t version = minimumVersion(contentResult, ec);
+    array<uint8_t, MaxCodewords> codewords;
+    const span<uint8_t> sequence(codewords.data(), interleaving(version, ec).size());
+    finalSequence(bits, version, ec, sequence);
+    Symbol result(version, resource);
+    result.setData(sequence, ec, mask, maskPolicy);
+    return result;
+}
+
+
+/**
+ * Splits \a data into segments and finds the smallest version from
+ * \a minVersion on which holds them, in one pass over the characters: the
+ * segmentation is optimized for all version ranges at once, then the version
+ * follows from the bit counts per range, and only the segments for its range
+ * are built. Numeric data takes a single segment, so its version follows
+ * from characterCapacities alone.
+ */
+QR::Segmentation QR::segment(string_view data, QRGen_ErrorCorrection ec, uint8_t minVersion) {
+    assert(1 <= minVersion && minVersion <= 40);
+    // only the first segmentCount segments are ever initialized
+    Segmentation result;
+    result.success = false;
+    result.segmentCount = 0;
+    result.utf8 = false;
+    result.version = 0;
     
-    // prepend header
-    EncodeResult result = { true, {}, contentResult.mode, contentResult.characterCount };
-    switch (result.mode) {
-    case Mode::numeric:
-    case Mode::alphanumeric:
-    case Mode::eightbit: {
-        result.bits.append(4, to_underlying(result.mode));
-        result.bits.append(characterCountBits(version, result.mode), result.characterCount);
-        result.bits.append(contentResult.bits);
-        break;
+    if (data.empty()) {
+        cerr << "data is empty" << endl;
+        return result;
+    }
+    // longer input cannot fit, and its costs could overflow in segmentCosts()
+    if (data.size() > MaxInputSize) {
+        cerr << "data is too long" << endl;
+        return result;
+    }
+    
+    const Mode mode = classify(data);
+    if (mode == Mode::terminator) {
+        cerr << "no supported mode supports the input data" << endl;
+        return result;
+    }
+    
+    if (mode == Mode::numeric) {
+        // numeric mode is the densest, so a single segment is optimal
+        for (uint8_t version = minVersion; version <= 40; ++version) {
+            if (data.size() <= characterCapacity(Mode::numeric, ec, version)) {
+                result.success = true;
+                result.segments[0] = { Mode::numeric, data };
+                result.segmentCount = 1;
+                result.version = version;
+                return result;
+            }
+        }
+        cerr << "data is too long" << endl;
+        return result;
+    }
+    
+    const bool utf8 = mode == Mode::eci;
+    // the costs hold an entry per character, so they are filled in place
+    SegmentCosts costs;
+    segmentCosts(data, utf8, costs);
+    array<uint32_t, VersionRangeCount> bitCounts = costs.bitCounts;
+    array<bool, VersionRangeCount> eci{};
+    SegmentCosts kanjiCosts;
+    if (utf8) {
+        // the ECI header, unless kanji mode covers the characters outside
+        // ISO 8859-1 with fewer bits
+        segmentCosts(data, false, kanjiCosts);
+        for (size_t range = 0; range < VersionRangeCount; ++range) {
+            bitCounts[range] += 4 + 8;
+            eci[range] = kanjiCosts.bitCounts[range] > bitCounts[range];
+            if (!eci[range]) { bitCounts[range] = kanjiCosts.bitCounts[range]; }
+        }
+    }
+    
+    const uint8_t version = minimumVersion(bitCounts, ec, minVersion);
+    if (version == 0) {
+        cerr << "data is too long" << endl;
+        return result;
+    }
+    const size_t range = versionRange(version);
+    result.success = true;
+    result.segmentCount = segments(data, utf8 && !eci[range] ? kanjiCosts : costs, range, result.segments);
+    result.utf8 = eci[range];
+    result.version = version;
+    return result;
+}
+
+
+/** The length of the UTF-8 sequence starting with the byte \a lead. */
+static inline size_t utf8Length(uint8_t lead) {
+    if (lead < 0x80) { return 1; }
+    if (lead < 0xE0) { return 2; }
+    if (lead < 0xF0) { return 3; }
+    return 4;
+}
+
+
+// the modes of the segmentation, by index
+static constexpr size_t ModeCount = 4;
+static constexpr array<uint8_t, ModeCount> segmentModeBits = { NumericBit, AlphanumericBit, EightbitBit, KanjiBit };
+
+
+/**
+ * Finds the segmentation of the valid UTF-8 string \a data with the fewest
+ * bits, for the character count indicator widths of each version range. This
+ * is a dynamic program over the characters, keeping for each mode the
+ * cheapest encoding of the characters so far which ends in that mode. Costs
+ * are counted in sixths of a bit, so that numeric (10 bits per 3) and
+ * alphanumeric (11 bits per 2) characters have whole costs; a segment is
+ * rounded up to whole bits when it ends. Without \a utf8, the bit counts are
+ * UINT32_MAX if a character is neither ISO 8859-1 nor kanji. \a data must not
+ * be longer than MaxInputSize.
+ */
+void QR::segmentCosts(string_view data, bool utf8, SegmentCosts &result) {
+    static constexpr array<Mode, ModeCount> modes = { Mode::numeric, Mode::alphanumeric, Mode::eightbit, Mode::kanji };
+    static constexpr array<uint32_t, ModeCount> characterCosts = { 20, 33, 48, 78 };
+    static constexpr uint32_t infinite = numeric_limits<uint32_t>::max() / 2;
+    static constexpr array<uint8_t, VersionRangeCount> rangeVersions = { 1, 10, 27 };
+    
+    array<array<uint32_t, ModeCount>, VersionRangeCount> headerCosts;
+    for (size_t range = 0; range < VersionRangeCount; ++range) {
+        for (size_t m = 0; m < ModeCount; ++m) {
+            headerCosts[range][m] = (4 + characterCountBits(rangeVersions[range], modes[m])) * 6;
+        }
     }
-    default:
-        cerr << "cannot generate header for unsupported mode: " << toString(result.mode) << endl;
+    
+    assert(data.size() <= MaxInputSize);
+    size_t characterCount = 0;
+    array<array<uint32_t, ModeCount>, VersionRangeCount> costs = headerCosts;
+    for (size_t i = 0; i < data.size();) {
+        const uint8_t lead = data[i];
+        size_t length = 1;
+        // with UTF-8, every character is encodable as its bytes
+        uint8_t encodable = utf8 ? EightbitBit : 0;
+        if (lead < 0x80) {
+            encodable |= characterModes[lead];
+        } else {
+            char32_t c;
+            length = decodeUtf8(data, i, c);
+            encodable |= modesOf(c);
+        }
+        if ((encodable & (NumericBit | AlphanumericBit | EightbitBit | KanjiBit)) == 0) {
+            result.bitCounts.fill(numeric_limits<uint32_t>::max());
+            result.characterCount = 0;
+            return;
+        }
+        const size_t byteCount = utf8 ? length : 1;
+        i += length;
+        
+        array<uint32_t, ModeCount> characterCost;
+        for (size_t m = 0; m < ModeCount; ++m) {
+            characterCost[m] = encodable & segmentModeBits[m]
+                ? characterCosts[m] * (modes[m] == Mode::eightbit ? byteCount : 1) : infinite;
+        }
+        
+        array<uint8_t, VersionRangeCount> &from = result.modeOf[characterCount++];
+        for (size_t range = 0; range < VersionRangeCount; ++range) {
+            array<uint32_t, ModeCount> &cost = costs[range];
+            uint8_t fromBits = 0b11'10'01'00; // every mode continues
+            for (size_t m = 0; m < ModeCount; ++m) {
+                cost[m] = min(cost[m] + characterCost[m], infinite);
+            }
+            
+            // switch to another mode after this character
+            const array<uint32_t, ModeCount> ended = cost;
+            for (size_t to = 0; to < ModeCount; ++to) {
+                for (size_t m = 0; m < ModeCount; ++m) {
+                    if (ended[m] >= infinite) { continue; }
+                    const uint32_t switched = (ended[m] + 5) / 6 * 6 + headerCosts[range][to];
+                    if (switched < cost[to]) {
+                        cost[to] = switched;
+                        fromBits = (fromBits & ~(0b11 << (2 * to))) | (m << (2 * to));
+                    }
+                }
+            }
+            from[range] = fromBits;
+        }
+    }
+    
+    result.characterCount = characterCount;
+    for (size_t range = 0; range < VersionRangeCount; ++range) {
+        const auto cheapest = min_element(costs[range].begin(), costs[range].end());
+        result.bitCounts[range] = (*cheapest + 5) / 6;
+        result.lastMode[range] = cheapest - costs[range].begin();
+    }
+}
+
+
+/**
+ * Stores the segments of \a data for \a versionRange in \a result, following
+ * the modes of the cheapest encoding found by segmentCosts() back from the
+ * last character, and returns their number. The segments must fit into a
+ * version of the range, so there are at most MaxSegments.
+ */
+size_t QR::segments(string_view data, const SegmentCosts &costs, size_t versionRange, span<Segment> result) {
+    static constexpr array<Mode, ModeCount> modes = { Mode::numeric, Mode::alphanumeric, Mode::eightbit, Mode::kanji };
+    
+    const size_t characterCount = costs.characterCount;
+    array<uint8_t, MaxInputSize> characterMode;
+    uint8_t mode = costs.lastMode[versionRange];
+    for (size_t i = characterCount; i-- > 0;) {
+        mode = (costs.modeOf[i][versionRange] >> (2 * mode)) & 0b11;
+        characterMode[i] = mode;
+    }
+    
+    size_t segmentCount = 0;
+    size_t begin = 0;
+    for (size_t i = 0, position = 0; i < characterCount; ++i) {
+        position += utf8Length(data[position]);
+        if (i + 1 == characterCount || characterMode[i + 1] != characterMode[i]) {
+            assert(segmentCount < result.size());
+            result[segmentCount++] = { modes[characterMode[i]], data.substr(begin, position - begin) };
+            begin = position;
+        }
+    }
+    return segmentCount;
+}
+
+
+/**
+ * The bit stream of the segments of \a segmentation in its version: the ECI
+ * header if needed, each segment with its header, and the terminator.
+ */
+Data QR::encodeSegments(const Segmentation &segmentation, QRGen_ErrorCorrection ec) {
+    assert(segmentation.success);
+    Data bits;
+    if (segmentation.utf8) {
+        bits.append(4, to_underlying(Mode::eci));
+        bits.append(8, Utf8Eci);
+    }
+    for (size_t i = 0; i < segmentation.segmentCount; ++i) {
+        encodeSegment(segmentation.segments[i], segmentation.utf8, segmentation.version, bits);
+    }
+    
+    appendTerminator(bits, segmentation.version, ec);
+    return bits;
+}
+
+
+/**
+ * Fills \a bits, which end with the terminator, up to the capacity of
+ * \a version: with 0 bits up to the next byte boundary, then with the pad
+ * codewords 0xEC and 0x11 in turn, as per section 7.4.10 of ISO/IEC
+ * 18004:2015.
+ */
+void QR::appendPadding(Data &bits, uint8_t version, QRGen_ErrorCorrection ec) {
+    const size_t capacity = dataBitsCounts[version - 1][to_underlying(ec)];
+    bits.padLastByte();
+    assert(bits.bitCount() <= capacity);
+    
+    // two pad codewords at a time
+    while (bits.bitCount() + 8 < capacity) {
+        bits.append(16, 0b11101100'00010001);
+    }
+    if (bits.bitCount() < capacity) {
+        bits.append(8, 0b11101100);
+    }
+}
+
+
+/** Appends the terminator, or as much of it as fits into \a version. */
+void QR::appendTerminator(Data &bits, uint8_t version, QRGen_ErrorCorrection ec) {
+    const size_t capacity = dataBitsCounts[version - 1][to_underlying(ec)];
+    assert(bits.bitCount() <= capacity);
+    const size_t terminatorBits = min(size_t{4}, capacity - bits.bitCount());
+    bits.append(terminatorBits, to_underlying(Mode::terminator));
+}
+
+
+/**
+ * Appends \a segment with its header, i.e. the mode indicator and the
+ * character count indicator for \a version, to \a bits. With \a utf8,
+ * eightbit segments hold UTF-8 bytes.
+ */
+void QR::encodeSegment(const Segment &segment, bool utf8, uint8_t version, Data &bits) {
+    if (segment.mode != Mode::numeric && segment.mode != Mode::alphanumeric
+            && segment.mode != Mode::eightbit && segment.mode != Mode::kanji) {
+        cerr << "cannot generate header for unsupported mode: " << toString(segment.mode) << endl;
         assert(false);
-        return failure;
+        return;
+    }
+    
+    // the header comes first, so count the characters before encoding them:
+    // eightbit segments without utf8 and kanji segments count UTF-8 characters
+    const bool countCharacters = segment.mode == Mode::kanji || (segment.mode == Mode::eightbit && !utf8);
+    const uint32_t characterCount = countCharacters
+        ? count_if(segment.data.begin(), segment.data.end(), [](char c) { return (uint8_t(c) & 0xC0) != 0x80; })
+        : segment.data.size();
+    const uint32_t C = characterCountBits(version, segment.mode);
+    assert(characterCount < (uint32_t{1} << C));
+    [[maybe_unused]] const size_t start = bits.bitCount();
+    bits.append(4, to_underlying(segment.mode));
+    bits.append(C, characterCount);
+    
+    [[maybe_unused]] uint16_t encodedCount = 0;
+    switch (segment.mode) {
+    case Mode::numeric: encodedCount = encodeNumeric(segment.data, bits); break;
+    case Mode::alphanumeric: encodedCount = encodeAlphanumeric(segment.data, bits); break;
+    case Mode::eightbit:
+        encodedCount = utf8 ? encodeUtf8(segment.data, bits) : encodeEightbit(segment.data, bits);
+        break;
+    case Mode::kanji: encodedCount = encodeKanji(segment.data, bits); break;
+    default:;
     }
+    assert(encodedCount == characterCount);
 
 #ifndef NDEBUG
     // check result size
-    const uint32_t B = result.bits.bitCount();
-    const uint32_t C = characterCountBits(version, result.mode);
-    const uint32_t D = data.size();
+    const uint32_t B = bits.bitCount() - start;
+    const uint32_t D = characterCount;
     const uint32_t R = (D % 3) * 3 + (D % 3 == 0 ? 0 : 1);
-    switch (result.mode) {
+    switch (segment.mode) {
     case Mode::numeric:
         // this formula is given at the end of section 7.4.3 of ISO 18004:2015
         assert(B == 4 + C + 10 * (D / 3) + R);
@@ -197,100 +621,186 @@ QR::EncodeResult QR::encodeSegment(std::u16string_view data, QRGen_ErrorCorrecti
     default:;
     }
 #endif
-    
-    // append terminator
-    size_t spaceAvailable = dataBitsCounts[version - 1][to_underlying(ec)] - result.bits.bitCount();
-    size_t terminatorBits = min(size_t{4}, spaceAvailable);
-    result.bits.append(terminatorBits, to_underlying(Mode::terminator));
-    
-    return result;    
 }
 
 
-QR::EncodeResult QR::encodeContent(u16string_view data) {
-    static const EncodeResult failure { false, {}, Mode::terminator, 0 };
+void QR::finalSequence(const Data &bits, uint8_t version, QRGen_ErrorCorrection ec, span<uint8_t> result) {
+    const vector<uint16_t> &positions = interleaving(version, ec);
+    assert(result.size() == positions.size());
     
-    if (data.empty()) {
-        cerr << "data is empty" << endl;
-        return failure;
+    // All blocks of a group have the same size, so their error correction
+    // codewords are calculated in one batch. All blocks have the same number
+    // of error correction codewords, which are stored block after block.
+    const uint8_t *data = bits.data().data();
+    array<uint8_t, MaxEccCodewords> eccCodewords;
+    array<const uint8_t*, MaxBlocks> blocks;
+    array<uint8_t*, MaxBlocks> remainders;
+    size_t dataCodewordCount = 0;
+    size_t blockCount = 0;
+    size_t eccCount = 0;
+    for (size_t moduleType = 0; moduleType < 2; ++moduleType) {
+        const array<uint16_t, 3> &counts = ecBlocks[version - 1][to_underlying(ec)][moduleType];
+        if (counts[0] == 0) { continue; }
+        const size_t dataCount = counts[2];
+        eccCount = counts[1] - counts[2];
+        for (size_t block = 0; block < counts[0]; ++block) {
+            assert(dataCodewordCount + dataCount <= bits.size());
+            blocks[blockCount + block] = data + dataCodewordCount;
+            remainders[blockCount + block] = eccCodewords.data() + (blockCount + block) * eccCount;
+            dataCodewordCount += dataCount;
+        }
+        ECCCalculator::feedBlocks(&blocks[blockCount], &remainders[blockCount], counts[0], dataCount, eccCount);
+        blockCount += counts[0];
     }
     
-    const bool isEightbit =  all_of(data.begin(), data.end(), bind(containsKey, ISO8859_1, _1));
-    const bool isKanji = false;
-    (void)isKanji; // TODO
-    
-    if (isNumeric(data)) {
-        return encodeNumeric(data);
-    } else if (isAlphaNumeric(data)) {
-        return encodeAlphanumeric(data);
-    } else if (isEightbit) {
-        return encodeEightbit(data);
+    for (size_t i = 0; i < dataCodewordCount; ++i) {
+        result[positions[i]] = data[i];
+    }
+    for (size_t i = 0; i < blockCount * eccCount; ++i) {
+        result[positions[dataCodewordCount + i]] = eccCodewords[i];
     }
-    
-    cerr << "no supported mode supports the input data" << endl;
-    return failure;    
 }
 
 
-vector<uint8_t> QR::finalSequence(Data &bits, uint8_t version, QRGen_ErrorCorrection ec) {
-    size_t offset = 0;
-    vector<vector<uint8_t>> dataCodewordBlocks;
-    vector<vector<uint8_t>> ecCodewordBlocks;
-    for (size_t moduleType = 0; moduleType < 2; ++moduleType) {
-        const array<uint16_t, 3> &counts = ecBlocks[version - 1][to_underlying(ec)][moduleType];
-        for (size_t block = 0; block < counts[0]; ++block) {
-            const size_t dataCount = counts[2];
-            assert(offset + dataCount <= bits.size());
-            auto begin = &bits.data()[offset];
-            auto end = &bits.data()[offset + dataCount];
-            dataCodewordBlocks.emplace_back(begin, end);
-            
-            const size_t eccwCount = counts[1] - counts[2];
-            ecCodewordBlocks.emplace_back(ECCCalculator::feed(begin, end, eccwCount));
-            
-            offset += dataCount;
-        }
-    }
+/**
+ * The position in the final sequence of each codeword of \a version and
+ * \a ec, as specified by chapter 7.6 of ISO/IEC 18004:2015: first the first
+ * data codeword of each block, then the second data codeword of each block,
+ * etc., followed by the error correction codewords in the same way. Codewords
+ * are numbered block by block, first all data codewords, then all error
+ * correction codewords. The tables are built on first use and never modified
+ * afterwards, so they can be shared between threads.
+ */
+const vector<uint16_t> &QR::interleaving(uint8_t version, QRGen_ErrorCorrection ec) {
+    assert(1 <= version && version <= 40);
+    static array<once_flag, 40 * 4> flags;
+    static array<vector<uint16_t>, 40 * 4> tables;
     
-    // Order codewords as specified by chapter 7.6 of ISO/IEC 18004:2015.
-    // This means first all data code words, then all error correction codewords
-    // And within those groups, first the first codeword from each block, then
-    // the second codeword from each block, etc..
-    vector<uint8_t> result;
-    for (size_t i = 0; i < dataCodewordBlocks.back().size(); ++i) {
-        for (size_t blockNo = 0; blockNo < dataCodewordBlocks.size(); ++blockNo) {
-            if (i < dataCodewordBlocks[blockNo].size()) {
-                result.push_back(dataCodewordBlocks[blockNo][i]);
+    const size_t index = (version - 1) * 4 + to_underlying(ec);
+    vector<uint16_t> &positions = tables[index];
+    call_once(flags[index], [&]() {
+        // the first codeword and the number of data codewords of each block
+        vector<size_t> offsets;
+        vector<size_t> dataCounts;
+        size_t dataCodewordCount = 0;
+        size_t eccCount = 0;
+        for (const array<uint16_t, 3> &counts : ecBlocks[version - 1][to_underlying(ec)]) {
+            for (size_t block = 0; block < counts[0]; ++block) {
+                offsets.push_back(dataCodewordCount);
+                dataCounts.push_back(counts[2]);
+                dataCodewordCount += counts[2];
+                eccCount = counts[1] - counts[2];
             }
         }
-    }
-    for (size_t i = 0; i < ecCodewordBlocks.front().size(); ++i) {
-        for (size_t blockNo = 0; blockNo < ecCodewordBlocks.size(); ++blockNo) {
-            result.push_back(ecCodewordBlocks[blockNo][i]);
+        const size_t blockCount = offsets.size();
+        
+        positions.resize(dataCodewordCount + blockCount * eccCount);
+        size_t position = 0;
+        for (size_t i = 0; i < dataCounts.back(); ++i) {
+            for (size_t block = 0; block < blockCount; ++block) {
+                if (i < dataCounts[block]) { positions[offsets[block] + i] = position++; }
+            }
         }
+        for (size_t i = 0; i < eccCount; ++i) {
+            for (size_t block = 0; block < blockCount; ++block) {
+                positions[dataCodewordCount + block * eccCount + i] = position++;
+            }
+        }
+        assert(position == positions.size());
+    });
+    return positions;
+}
+
+
+/**
+ * The most compact mode which can encode all characters of the UTF-8 string
+ * \a data, determined in a single pass: Mode::eci stands for UTF-8 bytes with
+ * an ECI header, needed for characters outside ISO 8859-1 unless they are all
+ * encoded in kanji mode. Returns Mode::terminator if \a data is not valid
+ * UTF-8. ASCII text is examined 8 bytes at a time.
+ */
+QR::Mode QR::classify(string_view data) {
+    uint8_t modes = NumericBit | AlphanumericBit | EightbitBit | Utf8Bit | KanjiBit;
+    size_t i = 0;
+    while (i < data.size()) {
+        if (data.size() - i >= 8 && isAscii8(&data[i])) {
+            for (size_t end = i + 8; i < end; ++i) { modes &= characterModes[uint8_t(data[i])]; }
+            continue;
+        }
+        if (uint8_t(data[i]) < 0x80) {
+            modes &= characterModes[uint8_t(data[i])];
+            ++i;
+            continue;
+        }
+        char32_t c;
+        const size_t length = decodeUtf8(data, i, c);
+        if (length == 0) { return Mode::terminator; }
+        modes &= modesOf(c);
+        i += length;
     }
-    
-    return result;
+    if (modes & NumericBit) { return Mode::numeric; }
+    if (modes & AlphanumericBit) { return Mode::alphanumeric; }
+    if (modes & EightbitBit) { return Mode::eightbit; }
+    if (modes & KanjiBit) { return Mode::kanji; }
+    return Mode::eci;
 }
 
 
-bool QR::isNumeric(char16_t c) {
+bool QR::isNumeric(char c) {
     return '0' <= c && c <= '9'; 
 }
 
 
-bool QR::isNumeric(std::u16string_view s) {
-    return all_of(s.begin(), s.end(), static_cast<bool(*)(char16_t)>(&QR::isNumeric));
+bool QR::isNumeric(std::string_view s) {
+    return all_of(s.begin(), s.end(), static_cast<bool(*)(char)>(&QR::isNumeric));
+}
+
+
+bool QR::isAlphaNumeric(char c) {
+    return alphaNumericCharacters[uint8_t(c)] >= 0;
+}
+
+
+bool QR::isAlphaNumeric(std::string_view s) {
+    return all_of(s.begin(), s.end(), static_cast<bool(*)(char)>(&QR::isAlphaNumeric));
 }
 
 
-bool QR::isAlphaNumeric(char16_t c) {
-    return alphaNumericCharacters.find(c) != alphaNumericCharacters.end();
+/** The range of \a version, 0 for 1-9, 1 for 10-26 and 2 for 27-40. */
+size_t QR::versionRange(uint8_t version) {
+    assert(1 <= version && version <= 40);
+    return version <= 9 ? 0 : version <= 26 ? 1 : 2;
 }
 
 
-bool QR::isAlphaNumeric(std::u16string_view s) {
-    return all_of(s.begin(), s.end(), static_cast<bool(*)(char16_t)>(&QR::isAlphaNumeric));
+/**
+ * The smallest version from \a minVersion on whose data capacity holds the
+ * bit count of its version range, or 0 if there is none.
+ */
+uint8_t QR::minimumVersion(const array<uint32_t, VersionRangeCount> &bitCounts, QRGen_ErrorCorrection ec,
+                           uint8_t minVersion) {
+    for (uint8_t version = minVersion; version <= 40; ++version) {
+        if (bitCounts[versionRange(version)] <= dataBitsCounts[version - 1][to_underlying(ec)]) { return version; }
+    }
+    return 0;
+}
+
+
+/**
+ * The number of characters of \a mode (numeric, alphanumeric, eightbit or
+ * kanji) which fit into one segment of \a version.
+ */
+uint16_t QR::characterCapacity(Mode mode, QRGen_ErrorCorrection ec, uint8_t version) {
+    assert(1 <= version && version <= 40);
+    size_t m;
+    switch (mode) {
+    case Mode::numeric: m = 0; break;
+    case Mode::alphanumeric: m = 1; break;
+    case Mode::eightbit: m = 2; break;
+    case Mode::kanji: m = 3; break;
+    default: assert(false); return 0;
+    }
+    return characterCapacities[m][to_underlying(ec)][version - 1];
 }
 
 
@@ -319,14 +829,97 @@ uint32_t QR::characterCountBits(uint8_t version, Mode encodeMode) {
 }
 
 
-QR::EncodeResult QR::encodeNumeric(std::u16string_view data) {
+#ifdef QRGEN_X86_SIMD
+// The SIMD packers convert 16 characters per vector and append the same bits
+// as the scalar loops of encodeNumeric() and encodeAlphanumeric(), which
+// encode the characters left over. The characters have been checked by
+// classify() or segment() already, so they are not validated again.
+
+/** Converts the 12 digits at \a p into 4 10 bit values, returned as one 40 bit word. */
+__attribute__((target("ssse3")))
+static inline uint64_t packDigitTriplets(const char *p) {
+    const __m128i digits = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), _mm_set1_epi8('0'));
+    // spread each triplet over 4 bytes, then weigh and add its digits
+    const __m128i triplets = _mm_shuffle_epi8(digits, _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1,
+                                                                    6, 7, 8, -1, 9, 10, 11, -1));
+    const __m128i partial = _mm_maddubs_epi16(triplets, _mm_setr_epi8(100, 10, 1, 0, 100, 10, 1, 0,
+                                                                      100, 10, 1, 0, 100, 10, 1, 0));
+    const __m128i values = _mm_madd_epi16(partial, _mm_set1_epi16(1));
+    // join two values each into 20 bits
+    const __m128i pairs = _mm_madd_epi16(_mm_packs_epi32(values, values),
+                                         _mm_setr_epi16(1 << 10, 1, 1 << 10, 1, 0, 0, 0, 0));
+    return uint64_t(uint32_t(_mm_cvtsi128_si32(pairs))) << 20
+           | uint32_t(_mm_cvtsi128_si32(_mm_srli_si128(pairs, 4)));
+}
+
+
+/** Appends digits of \a data 24 at a time to \a bits, and returns how many. */
+__attribute__((target("ssse3")))
+static size_t encodeNumericSSSE3(string_view data, Data &bits) {
+    size_t i = 0;
+    for (; i + 28 <= data.size(); i += 24) { // the second load reads 16 bytes from i + 12
+        bits.appendWord(40, packDigitTriplets(&data[i]));
+        bits.appendWord(40, packDigitTriplets(&data[i + 12]));
+    }
+    return i;
+}
+
+
+/**
+ * Converts the 16 alphanumeric characters at \a p into 8 11 bit pair values,
+ * returned as two 44 bit words.
+ */
+__attribute__((target("ssse3")))
+static inline array<uint64_t, 2> packAlphanumericPairs(const char *p) {
+    const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    // digits and ':' follow '0', letters follow 'A', and the other characters
+    // are below '0' and looked up by their low nibble
+    const __m128i colon = _mm_and_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8(':')), _mm_set1_epi8(44 - 10));
+    const __m128i digit = _mm_add_epi8(_mm_sub_epi8(c, _mm_set1_epi8('0')), colon);
+    const __m128i letter = _mm_sub_epi8(c, _mm_set1_epi8('A' - 10));
+    const __m128i other = _mm_shuffle_epi8(_mm_setr_epi8(36, 0, 0, 0, 37, 38, 0, 0, 0, 0, 39, 40, 0, 41, 42, 43), c);
+    const __m128i isLetter = _mm_cmpgt_epi8(c, _mm_set1_epi8('A' - 1));
+    const __m128i isOther = _mm_cmpgt_epi8(_mm_set1_epi8('0'), c);
+    __m128i index = _mm_or_si128(_mm_and_si128(isOther, other), _mm_andnot_si128(isOther, digit));
+    index = _mm_or_si128(_mm_and_si128(isLetter, letter), _mm_andnot_si128(isLetter, index));
+    
+    // 45 * first + second per pair, then two pairs each joined into 22 bits
+    const __m128i pairs = _mm_maddubs_epi16(index, _mm_setr_epi8(45, 1, 45, 1, 45, 1, 45, 1,
+                                                                 45, 1, 45, 1, 45, 1, 45, 1));
+    const __m128i words = _mm_madd_epi16(pairs, _mm_setr_epi16(1 << 11, 1, 1 << 11, 1, 1 << 11, 1, 1 << 11, 1));
+    alignas(16) array<uint32_t, 4> w;
+    _mm_store_si128(reinterpret_cast<__m128i*>(w.data()), words);
+    return { uint64_t(w[0]) << 22 | w[1], uint64_t(w[2]) << 22 | w[3] };
+}
+
+
+/** Appends alphanumeric characters of \a data 32 at a time to \a bits, and returns how many. */
+__attribute__((target("ssse3")))
+static size_t encodeAlphanumericSSSE3(string_view data, Data &bits) {
+    size_t i = 0;
+    for (; i + 32 <= data.size(); i += 32) {
+        for (size_t offset : { 0, 16 }) {
+            const array<uint64_t, 2> words = packAlphanumericPairs(&data[i + offset]);
+            bits.appendWord(44, words[0]);
+            bits.appendWord(44, words[1]);
+        }
+    }
+    return i;
+}
+#endif // QRGEN_X86_SIMD
+
+
+/** Appends the digits \a data to \a bits, and returns their number. */
+uint16_t QR::encodeNumeric(std::string_view data, Data &bits) {
     assert(data.size() > 0 && data.size() <= numeric_limits<uint16_t>::max());
     assert(isNumeric(data));
     
-    Data bits;
-    size_t i;
+    size_t i = 0;
+#ifdef QRGEN_X86_SIMD
+    if (CPU::hasSSSE3()) { i = encodeNumericSSSE3(data, bits); }
+#endif
     
-    for (i = 0; i + 2 < data.size(); i += 3) { // convert 3 characters into 10 bits and append
+    for (; i + 2 < data.size(); i += 3) { // convert 3 characters into 10 bits and append
         const uint32_t value = (data[i] - '0') * 100 + (data[i + 1] - '0') * 10 + (data[i + 2] - '0');
         bits.append(10, value);
     }
@@ -339,59 +932,93 @@ QR::EncodeResult QR::encodeNumeric(std::u16string_view data) {
         bits.append(4, value);
     }
     
-    return { true, bits, Mode::numeric, static_cast<uint16_t>(data.size()) };
+    return static_cast<uint16_t>(data.size());
 }
 
 
-QR::EncodeResult QR::encodeAlphanumeric(std::u16string_view data) {
+/** Appends the alphanumeric characters \a data to \a bits, and returns their number. */
+uint16_t QR::encodeAlphanumeric(std::string_view data, Data &bits) {
     assert(data.size() > 0 && data.size() <= numeric_limits<uint16_t>::max());
-    assert(all_of(data.begin(), data.end(), bind(containsKey, alphaNumericCharacters, _1)));
+    assert(isAlphaNumeric(data));
     
-    Data bits;
-    size_t i;
+    size_t i = 0;
+#ifdef QRGEN_X86_SIMD
+    if (CPU::hasSSSE3()) { i = encodeAlphanumericSSSE3(data, bits); }
+#endif
     
-    for (i = 0; i + 1 < data.size(); i += 2) { // convert 2 characters into 11 bits
-        const uint32_t value = alphaNumericCharacters.at(data[i]) * 45 +
-                               alphaNumericCharacters.at(data[i + 1]);
+    for (; i + 1 < data.size(); i += 2) { // convert 2 characters into 11 bits
+        const uint32_t value = alphaNumericCharacters[uint8_t(data[i])] * 45
+                             + alphaNumericCharacters[uint8_t(data[i + 1])];
         bits.append(11, value);
     }
     
     if (i + 1 == data.size()) { // 1 character is left, convert into 6 bits
-        const uint32_t value = alphaNumericCharacters.at(data[i]);
+        const uint32_t value = alphaNumericCharacters[uint8_t(data[i])];
         bits.append(6, value);
     }
     
-    return { true, bits, Mode::alphanumeric, static_cast<uint16_t>(data.size()) };
+    return static_cast<uint16_t>(data.size());
 }
 
 
-QR::EncodeResult QR::encodeEightbit(std::u16string_view data) {
+/**
+ * Appends the UTF-8 string \a data, all of whose characters are ISO 8859-1,
+ * as ISO 8859-1 bytes to \a bits, and returns the number of characters.
+ */
+uint16_t QR::encodeEightbit(std::string_view data, Data &bits) {
     assert(data.size() > 0 && data.size() <= numeric_limits<uint16_t>::max());
-    assert(all_of(data.begin(), data.end(), bind(containsKey, ISO8859_1, _1)));
+    assert(classify(data) != Mode::eci && classify(data) != Mode::terminator);
     
-    Data bits;
+    uint16_t characterCount = 0;
     
-    for (size_t i = 0; i < data.size(); ++i) {
-        const uint8_t value = ISO8859_1.at(data[i]);
-        bits.append(8, value);
+    for (size_t i = 0; i < data.size(); ++characterCount) {
+        if (uint8_t(data[i]) < 0x80) {
+            bits.append(8, uint8_t(data[i]));
+            ++i;
+        } else {
+            char32_t c;
+            i += decodeUtf8(data, i, c);
+            bits.append(8, ISO8859_1[c]);
+        }
     }
     
-    return { true, bits, Mode::eightbit, static_cast<uint16_t>(data.size()) };
+    return characterCount;
 }
 
 
-uint8_t QR::minimumVersion(uint32_t numContentBits, QRGen_ErrorCorrection ec) {
-    const uint8_t ecValue = to_underlying(ec);
+/**
+ * Appends the UTF-8 string \a data, all of whose characters are kanji
+ * characters, with 13 bits each as per section 7.4.6 of ISO/IEC 18004:2015
+ * to \a bits, and returns the number of characters.
+ */
+uint16_t QR::encodeKanji(std::string_view data, Data &bits) {
+    assert(data.size() > 0 && data.size() <= numeric_limits<uint16_t>::max());
     
-    for (uint8_t version = 1; version <= 40; ++version) {
-        if (numContentBits <= dataBitsCounts[version - 1][ecValue]) { return version; }
+    uint16_t characterCount = 0;
+    
+    for (size_t i = 0; i < data.size(); ++characterCount) {
+        char32_t c = uint8_t(data[i]);
+        const size_t length = c < 0x80 ? 1 : decodeUtf8(data, i, c);
+        assert(length > 0 && kanjiValue(c) >= 0);
+        bits.append(13, kanjiValue(c));
+        i += length;
     }
-    return 0;
+    
+    return characterCount;
 }
 
 
-uint8_t QR::minimumVersion(EncodeResult encodeResult, QRGen_ErrorCorrection ec) {
-    return minimumVersion(encodeResult.bits.bitCount(), ec);
+/**
+ * Appends the UTF-8 string \a data as its bytes to \a bits, for an eightbit
+ * segment. The character count, which is returned, is the number of bytes;
+ * the ECI header is prepended by encodeSegments().
+ */
+uint16_t QR::encodeUtf8(std::string_view data, Data &bits) {
+    assert(data.size() > 0 && data.size() <= numeric_limits<uint16_t>::max());
+    
+    for (char byte : data) { bits.append(8, uint8_t(byte)); }
+    
+    return static_cast<uint16_t>(data.size());
 }
 
 
@@ -406,19 +1033,3 @@ string QR::toString(QR::Mode mode) {
     default: assert(false); return "unknown";
     }
 }
-
-
-static unordered_map<char32_t, uint8_t> toMap(u32string_view s) {
-    unordered_map<char32_t, uint8_t> result;
-    for (size_t i = 0; i < s.size(); ++i) {
-        if (s[i] == U'∅') { continue; }     // skip unassigned
-        if (s[i] == U'∀') { result[U'\0'] = i; continue; } // zero
-        result[s[i]] = i;
-    }
-    return result;
-}
-
-
-static bool containsKey(const unordered_map<char32_t, uint8_t> map, char32_t key) {
-    return map.find(key) != map.end();
-}
@@ -10,7 +10,9 @@
 
 #include <array>
 #include <cstdint>
-#include <string>
+#include <memory_resource>
+#include <span>
+#include <string_view>
 #include <vector>
 #include "data.h"
 #include "qrgen.h"
@@ -23,40 +25,131 @@ public:
     
     QR() = delete;
     
-    static Symbol encode(std::u16string_view data,
+    /**
+     * Encodes the UTF-8 string \a data. Kanji characters may be encoded in
+     * kanji mode. Text with other characters outside ISO 8859-1 is encoded as
+     * UTF-8 bytes, with an ECI header designating UTF-8. The symbol's module
+     * plane is allocated from \a resource, all other working memory is on the
+     * stack.
+     */
+    static Symbol encode(std::string_view data,
                          QRGen_ErrorCorrection ec = QRGen_EC_M,
                          uint8_t version = 0,
-                         uint8_t mask = 255);
+                         uint8_t mask = 255,
+                         const Symbol::MaskPolicy &maskPolicy = {},
+                         std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+    
+    /**
+     * Encodes the binary \a data as is, in a single eightbit segment without
+     * an ECI header.
+     */
+    static Symbol encodeBytes(std::span<const uint8_t> data,
+                              QRGen_ErrorCorrection ec = QRGen_EC_M,
+                              uint8_t version = 0,
+                              uint8_t mask = 255,
+                              const Symbol::MaskPolicy &maskPolicy = {});
     
 private:
     enum class Mode : uint8_t { automatic = 16, eci = 7, numeric = 1, alphanumeric = 2,
                                 eightbit = 4, kanji = 8, structuredAppend = 3,
                                 fnc1_first = 5, fnc1_second = 9, terminator = 0 };
-    struct EncodeResult {
+    /** A run of characters of the input, encoded in one mode. */
+    struct Segment {
+        Mode mode; ///< numeric, alphanumeric, eightbit or kanji
+        std::string_view data;
+    };
+    
+    /**
+     * The most bytes of input any QR code can hold: digits, the densest
+     * characters, in version 40-L. No mode takes fewer bits per byte.
+     */
+    static constexpr size_t MaxInputSize = 7089;
+    
+    /**
+     * The most segments any QR code can hold: each takes at least 18 of the
+     * 23648 data bits of version 40-L (4 + 10 + 4 for a single digit, more
+     * in the other modes).
+     */
+    static constexpr size_t MaxSegments = 23648 / 18;
+    
+    /**
+     * The segments of the input with the fewest bits, and the smallest
+     * version they fit into.
+     */
+    struct Segmentation {
         bool success;
-        Data bits;
-        Mode mode;
-        uint16_t characterCount;
+        std::array<Segment, MaxSegments> segments; ///< of which the first segmentCount are used
+        size_t segmentCount;
+        bool utf8; ///< eightbit segments hold UTF-8, designated by an ECI header
+        uint8_t version;
     };
     
-    static EncodeResult encodeSegment(std::u16string_view data, QRGen_ErrorCorrection ec);
-    static EncodeResult encodeContent(std::u16string_view data);
-    /** Add error correction codewords and put everything into the final sequence order. */
-    static std::vector<uint8_t> finalSequence(Data &bits, uint8_t version, QRGen_ErrorCorrection ec);
+    /**
+     * The character count indicators change their widths at versions 10 and
+     * 27, which divides the versions into three ranges: 1-9, 10-26, 27-40.
+     */
+    static constexpr size_t VersionRangeCount = 3;
     
-    static bool isNumeric(char16_t c);
-    static bool isNumeric(std::u16string_view s);
-    static bool isAlphaNumeric(char16_t c);
-    static bool isAlphaNumeric(std::u16string_view s);
+    /** The cheapest segmentations of the input, for each version range. */
+    struct SegmentCosts {
+        /** Including the segment headers, UINT32_MAX if a character cannot be encoded. */
+        std::array<uint32_t, VersionRangeCount> bitCounts;
+        std::array<uint8_t, VersionRangeCount> lastMode; ///< the mode index of the last character
+        /**
+         * Per character and version range: the mode index of the character in
+         * the cheapest encoding up to it after which mode index m is active,
+         * in bits 2m and 2m + 1. The first characterCount entries are used.
+         */
+        std::array<std::array<uint8_t, VersionRangeCount>, MaxInputSize> modeOf;
+        size_t characterCount;
+    };
     
-    static uint32_t characterCountBits(uint8_t version, Mode encodeMode);
+    /** The ECI designator of UTF-8, as per the AIM ECI specification. */
+    static constexpr uint8_t Utf8Eci = 26;
+    
+    static Segmentation segment(std::string_view data, QRGen_ErrorCorrection ec, uint8_t minVersion = 1);
+    static void segmentCosts(std::string_view data, bool utf8, SegmentCosts &result);
+    static size_t segments(std::string_view data, const SegmentCosts &costs, size_t versionRange,
+                           std::span<Segment> result);
+    static Data encodeSegments(const Segmentation &segmentation, QRGen_ErrorCorrection ec);
+    static void encodeSegment(const Segment &segment, bool utf8, uint8_t version, Data &bits);
+    static void appendTerminator(Data &bits, uint8_t version, QRGen_ErrorCorrection ec);
+    static void appendPadding(Data &bits, uint8_t version, QRGen_ErrorCorrection ec);
+    static Symbol symbol(Data &bits, uint8_t version, QRGen_ErrorCorrection ec, uint8_t mask,
+                         const Symbol::MaskPolicy &maskPolicy,
+                         std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+    // The largest numbers of codewords, error correction codewords and blocks
+    // of any version and error correction level.
+    static constexpr size_t MaxCodewords = 3706;
+    static constexpr size_t MaxEccCodewords = 2430;
+    static constexpr size_t MaxBlocks = 81;
+    
+    /**
+     * Add error correction codewords and put everything into the final
+     * sequence order, in \a result, which must hold all codewords of the
+     * version.
+     */
+    static void finalSequence(const Data &bits, uint8_t version, QRGen_ErrorCorrection ec,
+                              std::span<uint8_t> result);
+    static const std::vector<uint16_t> &interleaving(uint8_t version, QRGen_ErrorCorrection ec);
     
-    static EncodeResult encodeNumeric(std::u16string_view data);
-    static EncodeResult encodeAlphanumeric(std::u16string_view data);
-    static EncodeResult encodeEightbit(std::u16string_view data);
+    static Mode classify(std::string_view data);
+    static bool isNumeric(char c);
+    static bool isNumeric(std::string_view s);
+    static bool isAlphaNumeric(char c);
+    static bool isAlphaNumeric(std::string_view s);
+    
+    static uint32_t characterCountBits(uint8_t version, Mode encodeMode);
+    static size_t versionRange(uint8_t version);
+    static uint8_t minimumVersion(const std::array<uint32_t, VersionRangeCount> &bitCounts,
+                                  QRGen_ErrorCorrection ec, uint8_t minVersion);
+    static uint16_t characterCapacity(Mode mode, QRGen_ErrorCorrection ec, uint8_t version);
     
-    static uint8_t minimumVersion(uint32_t numContentData, QRGen_ErrorCorrection ec);
-    static uint8_t minimumVersion(EncodeResult encodeResult, QRGen_ErrorCorrection ec);
+    static uint16_t encodeNumeric(std::string_view data, Data &bits);
+    static uint16_t encodeAlphanumeric(std::string_view data, Data &bits);
+    static uint16_t encodeEightbit(std::string_view data, Data &bits);
+    static uint16_t encodeUtf8(std::string_view data, Data &bits);
+    static uint16_t encodeKanji(std::string_view data, Data &bits);
     
     static std::string toString(Mode mode);
     
@@ -66,6 +159,13 @@ private:
     /** The number of error correction codewords required, per version, per error correction type. */
     static const std::array<std::array<uint16_t, 4>, 40> ecCodewordsCounts;
     
+    /**
+     * The number of characters a single segment can hold, per mode (numeric,
+     * alphanumeric, eightbit, kanji), per error correction type, per version.
+     * These are the capacities of table 7 of ISO/IEC 18004:2015.
+     */
+    static const std::array<std::array<std::array<uint16_t, 40>, 4>, 4> characterCapacities;
+    
     /**
      * The number of error correction codes per block. Array indices have the
      * following meanings, from the outside in:
@@ -1,31 +1,72 @@
 #include <qrgen.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <cstdio>
-#include <codecvt>
-#include <locale>
-#include <string>
+#include <memory_resource>
+#include <span>
+#include <string_view>
 #include "qr.h"
 
 using namespace std;
 
 
 static QRGen_Symbol *convertSymbol(const Symbol &symbol);
-static u16string fromUtf8(const char *data, size_t len);
+static bool copySymbol(const Symbol &symbol, QRGen_Symbol *result, size_t capacity);
 
 
 extern "C" {
 
 QRGen_Symbol *QRGen_encode(const char *data, size_t len) {
-    Symbol symbol = QR::encode(fromUtf8(data, len));
+    Symbol symbol = QR::encode(string_view(data, len));
     return convertSymbol(symbol);
 }
 
 
 struct QRGen_Symbol *QRGen_encode_ec(const char *data, size_t len, QRGen_ErrorCorrection ec) {
-    Symbol symbol = QR::encode(fromUtf8(data, len), ec);
+    Symbol symbol = QR::encode(string_view(data, len), ec);
     return convertSymbol(symbol);
 }
 
 
+struct QRGen_Symbol *QRGen_encode_bytes(const uint8_t *data, size_t len, QRGen_ErrorCorrection ec) {
+    Symbol symbol = QR::encodeBytes(span<const uint8_t>(data, len), ec);
+    return convertSymbol(symbol);
+}
+
+
+bool QRGen_encode_into(const char *data, size_t len, QRGen_ErrorCorrection ec,
+                       QRGen_Symbol *symbol, size_t capacity) {
+    return QRGen_encode_policy(data, len, ec, nullptr, nullptr, symbol, capacity);
+}
+
+
+bool QRGen_encode_policy(const char *data, size_t len, QRGen_ErrorCorrection ec,
+                         const QRGen_MaskPolicy *policy, QRGen_MaskReport *report,
+                         QRGen_Symbol *symbol, size_t capacity) {
+    if (symbol == nullptr) { return false; }
+    
+    Symbol::MaskPolicy maskPolicy;
+    if (policy) {
+        maskPolicy.selection = policy->selection;
+        maskPolicy.budget = chrono::microseconds(policy->budgetMicroseconds);
+    }
+    // The module plane lives on the stack like the rest of the working
+    // memory, so no memory is allocated.
+    array<uint64_t, Symbol::MaxModuleWords> modules;
+    pmr::monotonic_buffer_resource resource(modules.data(), sizeof(modules), pmr::null_memory_resource());
+    Symbol result = QR::encode(string_view(data, len), ec, 0, 255, maskPolicy, &resource);
+    if (report) {
+        const Symbol::MaskReport &maskReport = result.maskReport();
+        report->selection = maskReport.selection;
+        report->mask = maskReport.mask;
+        report->masksEvaluated = maskReport.masksEvaluated;
+        report->elapsedMicroseconds = chrono::duration<double, micro>(maskReport.elapsed).count();
+    }
+    return copySymbol(result, symbol, capacity);
+}
+
+
 void QRGen_free_symbol(QRGen_Symbol *symbol) {
     if (symbol) {
         if (symbol->data) {
@@ -52,8 +93,6 @@ static QRGen_Symbol *convertSymbol(const Symbol &symbol) {
         return nullptr;
     }
     
-    result->width = size;
-    result->height = size;
     result->data = reinterpret_cast<bool*>(malloc(sizeof(bool) * size * size));
     if (result->data == nullptr) {
         perror("malloc");
@@ -61,16 +100,34 @@ static QRGen_Symbol *convertSymbol(const Symbol &symbol) {
         return nullptr;
     }
     
-    // Cannot use memcpy because symbol.pixels() is packed, but result->data is not.
-    for(size_t i = 0; i < symbol.pixels().size(); ++i) {
-        result->data[i] = symbol.pixels()[i];
-    }
-    
+    copySymbol(symbol, result, size * size);
     return result;
 }
 
 
-static u16string fromUtf8(const char *data, size_t len) {
-    using CVT = codecvt_utf8_utf16<char16_t>;
-    return wstring_convert<CVT, char16_t>{}.from_bytes(&data[0], &data[len]);
+static bool copySymbol(const Symbol &symbol, QRGen_Symbol *result, size_t capacity) {
+    const size_t size = symbol.size();
+    
+    if (size == 0 || size * size > capacity) {
+        result->width = 0;
+        result->height = 0;
+        return false;
+    }
+    
+    // Unpack the module plane a row word at a time, since result->data holds
+    // one bool per module.
+    bool *out = result->data;
+    for (size_t y = 0; y < size; ++y) {
+        const span<const uint64_t> row = symbol.row(y);
+        for (size_t x = 0; x < size; x += 64) {
+            const uint64_t word = row[x / 64];
+            const size_t count = min(size - x, size_t{64});
+            for (size_t bit = 0; bit < count; ++bit) { *out++ = (word >> bit) & 1; }
+        }
+    }
+    
+    result->width = size;
+    result->height = size;
+    return true;
 }
+
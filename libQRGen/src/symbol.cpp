@@ -6,10 +6,16 @@
 // or (at your option) any later version.
 
 #include "symbol.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
 #include <cassert>
-#include <functional>
+#include <chrono>
 #include <limits>
+#include <mutex>
+#include <utility>
 #include <vector>
+#include "maskpenalties.h"
 #include "polynomial.h"
 
 using namespace std;
@@ -59,31 +65,98 @@ static const vector<uint8_t> positions[40] {
 };
 
 
-static const array<function<bool(size_t, size_t)>, 8> maskFun = {
-    [](size_t j, size_t i) -> bool { return (i + j) % 2 == 0; },
-    [](size_t j, size_t i) -> bool { (void)j; return i % 2 == 0; },
-    [](size_t j, size_t i) -> bool { (void)i; return j % 3 == 0; },
-    [](size_t j, size_t i) -> bool { return (i + j) % 3 == 0; },
-    [](size_t j, size_t i) -> bool { return (i / 2 + j / 3) % 2 == 0; },
-    [](size_t j, size_t i) -> bool { return i * j % 2 + i * j % 3 == 0; },
-    [](size_t j, size_t i) -> bool { return (i * j % 2 + i * j % 3) % 2 == 0; },
-    [](size_t j, size_t i) -> bool { return ((i + j) % 2 + i * j % 3) % 2 == 0; }
-};
+/**
+ * The data mask patterns as per table 10 of ISO/IEC 18004:2015, where i is
+ * the row and j the column of a module.
+ */
+static constexpr bool maskCondition(uint8_t mask, size_t j, size_t i) {
+    switch (mask) {
+    case 0: return (i + j) % 2 == 0;
+    case 1: return i % 2 == 0;
+    case 2: return j % 3 == 0;
+    case 3: return (i + j) % 3 == 0;
+    case 4: return (i / 2 + j / 3) % 2 == 0;
+    case 5: return i * j % 2 + i * j % 3 == 0;
+    case 6: return (i * j % 2 + i * j % 3) % 2 == 0;
+    case 7: return ((i + j) % 2 + i * j % 3) % 2 == 0;
+    default: return false;
+    }
+}
 
 
-Symbol::Symbol(uint8_t version)
-    : _version(version), _size(1 <= version && version <= 40 ? 17 + version * 4 : 0) {
-    if (_size == 0) { return; }
+/** The period of all mask patterns, both horizontally and vertically. */
+static constexpr size_t MaskPeriod = 12;
+
+
+/**
+ * Calculate one 12x12 tile of each mask pattern. Bit x of row y of tile k is
+ * set if mask k inverts the modules at (x + 12m, y + 12n).
+ */
+static constexpr array<array<uint16_t, MaskPeriod>, 8> calculateMaskTiles() {
+    array<array<uint16_t, MaskPeriod>, 8> result{};
+    for (uint8_t mask = 0; mask < 8; ++mask) {
+        for (size_t y = 0; y < MaskPeriod; ++y) {
+            for (size_t x = 0; x < MaskPeriod; ++x) {
+                if (maskCondition(mask, x, y)) { result[mask][y] |= 1u << x; }
+            }
+        }
+    }
+    return result;
+}
+
+
+static constexpr array<array<uint16_t, MaskPeriod>, 8> maskTiles = calculateMaskTiles();
+
+
+/**
+ * Calculate the 18 bit version information of each version: the version
+ * number followed by the 12 bit remainder of its division by the generator
+ * polynomial x¹² + x¹¹ + x¹⁰ + x⁹ + x⁸ + x⁵ + x² + 1, as per section 7.10 of
+ * ISO/IEC 18004:2015.
+ */
+static constexpr array<uint32_t, 41> calculateVersionInformation() {
+    constexpr uint32_t generatorPolynomial = 0b1'1111'0010'0101u;
     
-    _pixels.resize(_size * _size);
-    _pixelType.resize(_size * _size, PixelType::Unset);
-    _highlight.resize(_size * _size);
+    array<uint32_t, 41> result{};
+    for (uint32_t version = 7; version <= 40; ++version) {
+        uint32_t remainder = version << 12;
+        for (int bit = 17; bit >= 12; --bit) {
+            if (remainder & (1u << bit)) { remainder ^= generatorPolynomial << (bit - 12); }
+        }
+        result[version] = (version << 12) | remainder;
+    }
+    return result;
+}
+
+
+static constexpr array<uint32_t, 41> versionInformation = calculateVersionInformation();
+
+
+// see Symbol::maskStatistics()
+static atomic<uint64_t> maskSelections{0};
+static array<atomic<uint64_t>, 8> prunedMasks{};
+
+
+Symbol::Symbol(uint8_t version, pmr::memory_resource *resource)
+    : Symbol(version, 1 <= version && version <= 40 ? &functionPatterns(version) : nullptr, resource) {}
+
+
+/**
+ * Creates a symbol whose modules are copied from \a functionPatterns, or all
+ * light and unset if it is \c nullptr. The pixel types are those of the
+ * template, so they are only stored by a symbol without one.
+ */
+Symbol::Symbol(uint8_t version, const Template *functionPatterns, pmr::memory_resource *resource)
+    : _version(version), _size(1 <= version && version <= 40 ? 17 + version * 4 : 0),
+      _stride((_size + 63) / 64), _template(functionPatterns), _modules(resource) {
+    if (_size == 0) { return; }
     
-    drawFinderPatterns();
-    drawTimingPatterns();
-    drawAlignmentPatterns();
-    drawDarkModule();
-    drawVersionInformation();
+    if (_template) {
+        _modules.assign(_template->modules.begin(), _template->modules.end());
+    } else {
+        _modules.resize(_size * _stride);
+        _pixelType.resize(_size * _size, PixelType::Unset);
+    }
 }
 
 
@@ -92,28 +165,41 @@ size_t Symbol::size() const {
 }
 
 
-const std::vector<bool> Symbol::pixels() const {
-    return _pixels;
+span<const uint64_t> Symbol::modules() const {
+    return _modules;
+}
+
+
+size_t Symbol::stride() const {
+    return _stride;
 }
 
 
-const std::vector<Symbol::PixelType> Symbol::pixelType() const {
-    return _pixelType;
+span<const uint64_t> Symbol::row(int y) const {
+    assert(0 <= y && y < _size);
+    return span<const uint64_t>(&_modules[y * _stride], _stride);
+}
+
+
+span<const Symbol::PixelType> Symbol::pixelType() const {
+    return _template ? _template->pixelType : _pixelType;
 }
 
 
 bool Symbol::pixel(int x, int y) const {
     if (!valid(x, y)) { return false; }
-    return _pixels[toIndex(x, y)];
+    return module(x, y);
 }
 
 
 uint32_t Symbol::highlight(int x, int y) const {
+    if (_highlight.empty()) { return 0; }
     return _highlight[toIndex(x, y)];
 }
 
 
 void Symbol::highlightCodeword(size_t codewordNo, uint32_t highlight) {
+    if (_highlight.empty()) { _highlight.resize(_size * _size); }
     for (const Position &position : position(codewordNo)) {
         if (position.valid()) {
             _highlight[toIndex(position)] = highlight;
@@ -122,22 +208,200 @@ void Symbol::highlightCodeword(size_t codewordNo, uint32_t highlight) {
 }
 
 
-void Symbol::setData(const std::vector<uint8_t> &data, QRGen_ErrorCorrection ec, uint8_t mask) {
+void Symbol::setData(span<const uint8_t> data, QRGen_ErrorCorrection ec, uint8_t mask,
+                     const MaskPolicy &maskPolicy) {
+    _maskReport = MaskReport{maskPolicy.selection, mask, 0, {}};
+    if (!_template) { return; }
+    
+    drawCodewords(data);
+    ModulePlane plane;
+    const span<uint64_t> unmasked(plane.data(), _modules.size());
+    copy(_modules.begin(), _modules.end(), unmasked.begin());
+    
+    if (mask == 255) {
+        const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        if (maskPolicy.selection == QRGen_Mask_Exhaustive && maskPolicy.penaltyMethod == PenaltyMethod::BitSliced) {
+            MaskPenalties::Planes planes;
+            for (uint8_t mask = 0; mask < 8; ++mask) {
+                drawMask(unmasked, mask);
+                drawFormatInformation(mask, ec);
+                planes[mask].assign(_modules.begin(), _modules.end());
+            }
+            const MaskPenalties::Scores penalties = MaskPenalties::evaluate(planes, _size, maskPolicy.finderPenalty);
+            _maskReport.mask = min_element(penalties.begin(), penalties.end()) - penalties.begin();
+            _maskReport.masksEvaluated = 8;
+        } else {
+            selectMask(unmasked, ec, maskPolicy, _maskReport);
+        }
+        _maskReport.elapsed = chrono::steady_clock::now() - start;
+    }
+    drawMask(unmasked, _maskReport.mask);
+    drawFormatInformation(_maskReport.mask, ec);
+}
+
+
+void Symbol::setData(span<const uint8_t> data, QRGen_ErrorCorrection ec, uint8_t mask) {
+    setData(data, ec, mask, MaskPolicy{});
+}
+
+
+const Symbol::MaskReport &Symbol::maskReport() const {
+    return _maskReport;
+}
+
+
+Symbol::MaskStatistics Symbol::maskStatistics() {
+    MaskStatistics result;
+    result.selections = maskSelections.load(memory_order_relaxed);
+    for (size_t mask = 0; mask < 8; ++mask) { result.pruned[mask] = prunedMasks[mask].load(memory_order_relaxed); }
+    return result;
+}
+
+
+void Symbol::resetMaskStatistics() {
+    maskSelections.store(0, memory_order_relaxed);
+    for (atomic<uint64_t> &count : prunedMasks) { count.store(0, memory_order_relaxed); }
+}
+
+
+/**
+ * Selects the mask with the lowest penalty score for the data modules
+ * \a unmasked, the lowest-numbered one on ties, and stores it in \a report.
+ * The rules are scored cheapest first, and a mask is abandoned as soon as its
+ * partial penalty, plus the penalty bounds of the rules not scored yet,
+ * reaches the lowest penalty so far. The heuristic selection leaves out N3;
+ * the deadline selection stops once the budget has run out, checking it
+ * between rules. Leaves the last mask examined drawn.
+ */
+void Symbol::selectMask(span<const uint64_t> unmasked, QRGen_ErrorCorrection ec,
+                        const MaskPolicy &policy, MaskReport &report) {
+    const PenaltyBounds &bounds = _template->penaltyBounds;
+    const bool reference = policy.penaltyMethod == PenaltyMethod::Reference;
+    const bool heuristic = policy.selection == QRGen_Mask_Heuristic;
+    const chrono::steady_clock::time_point deadline = chrono::steady_clock::now() + policy.budget;
+    maskSelections.fetch_add(1, memory_order_relaxed);
+    
+    // The first mask is always scored.
+    auto expired = [&]() {
+        return policy.selection == QRGen_Mask_Deadline && report.masksEvaluated > 0
+            && chrono::steady_clock::now() >= deadline;
+    };
+    
     unsigned int lowestPenalty = numeric_limits<unsigned int>::max();
-    uint8_t bestMask = mask;
-    if (bestMask == 255) {
+    report.mask = 0;
+    report.masksEvaluated = 0;
+    report.selection = heuristic ? QRGen_Mask_Heuristic : QRGen_Mask_Exhaustive;
+    for (uint8_t mask = 0; mask < 8; ++mask) {
+        if (expired()) { break; }
+        drawMask(unmasked, mask);
+        drawFormatInformation(mask, ec);
+        
+        unsigned int bound = bounds.sameColorBlocks + bounds.adjacentSameColor
+                           + (heuristic ? 0 : bounds.pattern11311[size_t(policy.finderPenalty)]);
+        auto abandon = [&](unsigned int penalty) {
+            if (penalty + bound < lowestPenalty) { return false; }
+            prunedMasks[mask].fetch_add(1, memory_order_relaxed);
+            ++report.masksEvaluated;
+            return true;
+        };
+        
+        unsigned int penalty = evaluateDarkProportion();
+        if (abandon(penalty)) { continue; }
+        
+        bound -= bounds.sameColorBlocks;
+        penalty += reference ? evaluateSameColorBlocks() : evaluateSameColorBlocksBitboard();
+        if (abandon(penalty)) { continue; }
+        
+        if (expired()) { break; }
+        const ModulePlane columns = reference ? ModulePlane{} : transposed();
+        bound -= bounds.adjacentSameColor;
+        penalty += reference ? evaluateAdjacentSameColor() : evaluateAdjacentSameColorBitboard(columns);
+        if (abandon(penalty)) { continue; }
+        
+        if (!heuristic) {
+            if (expired()) { break; }
+            penalty += reference ? evaluate11311Pattern(policy.finderPenalty)
+                                 : evaluate11311PatternRunLength(columns, policy.finderPenalty);
+        }
+        ++report.masksEvaluated;
+        if (penalty < lowestPenalty) {
+            lowestPenalty = penalty;
+            report.mask = mask;
+        }
+    }
+    if (report.masksEvaluated < 8) { report.selection = QRGen_Mask_Deadline; }
+}
+
+
+const Symbol::Template &Symbol::functionPatterns(uint8_t version) {
+    assert(1 <= version && version <= 40);
+    static array<once_flag, 40> flags;
+    static array<Template, 40> templates;
+    
+    Template &functionPatterns = templates[version - 1];
+    call_once(flags[version - 1], [&]() {
+        Symbol symbol(version, nullptr, pmr::get_default_resource());
+        symbol.drawFinderPatterns();
+        symbol.drawFormatInformationArea();
+        symbol.drawTimingPatterns();
+        symbol.drawAlignmentPatterns();
+        symbol.drawDarkModule();
+        symbol.drawVersionInformation();
+        
+        functionPatterns.functionModules.resize(symbol._modules.size());
+        for (int y = 0; y < symbol._size; ++y) {
+            for (int x = 0; x < symbol._size; ++x) {
+                if (symbol._pixelType[symbol.toIndex(x, y)] != PixelType::Unset) {
+                    functionPatterns.functionModules[y * symbol._stride + x / 64] |= uint64_t{1} << (x % 64);
+                }
+            }
+        }
+        vector<uint64_t> fixedModules = functionPatterns.functionModules;
+        for (int y = 0; y < symbol._size; ++y) {
+            for (int x = 0; x < symbol._size; ++x) {
+                if (symbol._pixelType[symbol.toIndex(x, y)] == PixelType::FormatInformation) {
+                    fixedModules[y * symbol._stride + x / 64] &= ~(uint64_t{1} << (x % 64));
+                }
+            }
+        }
+        functionPatterns.penaltyBounds = symbol.evaluatePenaltyBounds(fixedModules);
+        
+        const size_t rowBits = 64 * symbol._stride;
+        for (Position position = symbol.startPosition(); position.valid();
+             position = symbol.nextPosition(position)) {
+            functionPatterns.placement.push_back(position.y * rowBits + position.x);
+        }
+        
         for (uint8_t mask = 0; mask < 8; ++mask) {
-            drawFormatInformation(mask, ec);
-            drawCodewords(data, mask);
-            const unsigned int penalty = evaluate();
-            if (penalty < lowestPenalty) {
-                lowestPenalty = penalty;
-                bestMask = mask;
+            vector<uint64_t> &maskPlane = functionPatterns.maskPlanes[mask];
+            maskPlane.resize(symbol._modules.size());
+            for (int y = 0; y < symbol._size; ++y) {
+                for (int x = 0; x < symbol._size; ++x) {
+                    if ((maskTiles[mask][y % MaskPeriod] >> (x % MaskPeriod)) & 1) {
+                        maskPlane[y * symbol._stride + x / 64] |= uint64_t{1} << (x % 64);
+                    }
+                }
+            }
+            for (size_t i = 0; i < maskPlane.size(); ++i) {
+                maskPlane[i] &= ~functionPatterns.functionModules[i];
             }
         }
-    }
-    drawFormatInformation(bestMask, ec);
-    drawCodewords(data, bestMask);
+        
+        // The pixel types of a symbol with data, which all symbols of the
+        // version share: the dark module is part of the format information,
+        // the codewords are data and the remainder bits blank.
+        symbol._pixelType[symbol.toIndex(8, symbol._size - 8)] = PixelType::FormatInformation;
+        const size_t codewordBits = functionPatterns.placement.size() / 8 * 8;
+        for (size_t i = 0; i < functionPatterns.placement.size(); ++i) {
+            const uint16_t bitIndex = functionPatterns.placement[i];
+            symbol._pixelType[symbol.toIndex(bitIndex % rowBits, bitIndex / rowBits)]
+                = i < codewordBits ? PixelType::Data : PixelType::Blank;
+        }
+        
+        functionPatterns.modules.assign(symbol._modules.begin(), symbol._modules.end());
+        functionPatterns.pixelType = std::move(symbol._pixelType);
+    });
+    return functionPatterns;
 }
 
 
@@ -161,26 +425,31 @@ void Symbol::drawAlignmentPatterns() {
 }
 
 
-void Symbol::drawCodewords(const std::vector<uint8_t> &data, uint8_t mask) {
-    Position position(startPosition());
-    for (uint8_t codeword : data) {
-        for (int bit = 7; bit >= 0; --bit) {
-            const size_t i = toIndex(position);
-            const bool value = (codeword & (1 << bit)) != 0;
-            const bool maskValue = maskFun[mask](position.x, position.y);
-            _pixels[i] = value ^ maskValue;
-            _pixelType[i] = PixelType::Data;
-            position = nextPosition(position);
-            if (!position.valid()) { return; }
+/**
+ * Draws the codewords in \a data into the data modules, unmasked. Modules
+ * after the data, i.e. the remainder bits, are light.
+ */
+void Symbol::drawCodewords(span<const uint8_t> data) {
+    const vector<uint16_t> &placement = _template->placement;
+    for (size_t i = 0; i < _modules.size(); ++i) { _modules[i] &= _template->functionModules[i]; }
+    
+    const size_t dataBitCount = min(placement.size(), 8 * data.size());
+    for (size_t i = 0; i < dataBitCount; ++i) {
+        if (data[i / 8] & (0x80 >> (i % 8))) {
+            _modules[placement[i] / 64] |= uint64_t{1} << (placement[i] % 64);
         }
     }
+}
 
-    for (;position.valid(); position = nextPosition(position)) {
-        const size_t i = toIndex(position);
-        const bool maskValue = maskFun[mask](position.x, position.y);
-        _pixels[i] = maskValue;
-        _pixelType[i] = PixelType::Blank;
-    }
+
+/**
+ * Sets the module plane to \a unmasked with \a mask applied to its data
+ * modules, a word at a time.
+ */
+void Symbol::drawMask(span<const uint64_t> unmasked, uint8_t mask) {
+    assert(mask < 8);
+    const vector<uint64_t> &maskPlane = _template->maskPlanes[mask];
+    for (size_t i = 0; i < _modules.size(); ++i) { _modules[i] = unmasked[i] ^ maskPlane[i]; }
 }
 
 
@@ -233,28 +502,41 @@ void Symbol::drawFormatInformation(uint8_t mask, QRGen_ErrorCorrection ec) {
     formatBits |= remainder;
     formatBits ^= 0b101010000010010u;
 
-    // Place format information around 11311 finder patterns
+    // Place format information around 11311 finder patterns. The pixel types
+    // are the template's, see drawFormatInformationArea().
     for (int i = 0; i < 6; ++i) {
-        drawPixel(8, i, formatBits & (1 << i), PixelType::FormatInformation);
-        drawPixel(_size - 1 - i, 8, formatBits & (1 << i), PixelType::FormatInformation);
+        setModule(8, i, formatBits & (1 << i));
+        setModule(_size - 1 - i, 8, formatBits & (1 << i));
     }
 
-    drawPixel(8, 7, formatBits & (1 << 6), PixelType::FormatInformation);
-    drawPixel(_size - 7, 8, formatBits & (1 << 6), PixelType::FormatInformation);
-    drawPixel(8, 8, formatBits & (1 << 7), PixelType::FormatInformation);
-    drawPixel(_size - 8, 8, formatBits & (1 << 7), PixelType::FormatInformation);
-    drawPixel(7, 8, formatBits & (1 << 8), PixelType::FormatInformation);
-    drawPixel(8, _size - 7, formatBits & (1 << 8), PixelType::FormatInformation);
+    setModule(8, 7, formatBits & (1 << 6));
+    setModule(_size - 7, 8, formatBits & (1 << 6));
+    setModule(8, 8, formatBits & (1 << 7));
+    setModule(_size - 8, 8, formatBits & (1 << 7));
+    setModule(7, 8, formatBits & (1 << 8));
+    setModule(8, _size - 7, formatBits & (1 << 8));
 
-    drawPixel(8, _size - 8, true, PixelType::FormatInformation); // single dark module at lower left finder pattern
+    setModule(8, _size - 8, true); // single dark module at lower left finder pattern
 
     for (int i = 9; i < 15; ++i) {
-        drawPixel(14 - i, 8, formatBits & (1 << i), PixelType::FormatInformation);
-        drawPixel(8, _size - 15 + i, formatBits & (1 << i), PixelType::FormatInformation);
+        setModule(14 - i, 8, formatBits & (1 << i));
+        setModule(8, _size - 15 + i, formatBits & (1 << i));
     }
 }
 
 
+/**
+ * Reserves the format information area, so that it is excluded from the data
+ * area before the format information is known.
+ */
+void Symbol::drawFormatInformationArea() {
+    drawRect(8, 0, 1, 9, false, PixelType::FormatInformation);
+    drawRect(0, 8, 8, 1, false, PixelType::FormatInformation);
+    drawRect(_size - 8, 8, 8, 1, false, PixelType::FormatInformation);
+    drawRect(8, _size - 7, 1, 7, false, PixelType::FormatInformation);
+}
+
+
 void Symbol::drawTimingPatterns() {
     assert(_size != 0);
     
@@ -268,12 +550,7 @@ void Symbol::drawTimingPatterns() {
 void Symbol::drawVersionInformation() {
     if (_version < 7) { return; }
     
-    static const Polynomial generatorPolynomial(0b1'1111'0010'0101u);
-    uint32_t versionBits = _version << 12;
-    const uint32_t remainder = (Polynomial(versionBits) % generatorPolynomial).value();
-    assert(remainder < (1u << 12));
-    versionBits |= remainder;
-    
+    const uint32_t versionBits = versionInformation[_version];
     for (int i = 0; i < 18; ++i) {
         const int x = i / 3;
         const int y = _size - 11 + i % 3;
@@ -284,15 +561,112 @@ void Symbol::drawVersionInformation() {
 }
 
 
-unsigned int Symbol::evaluate() const {
-    const unsigned int a = evaluateAdjacentSameColor();
-    const unsigned int b = evaluateSameColorBlocks();
-    const unsigned int c = evaluate11311Pattern();
+unsigned int Symbol::evaluate(PenaltyMethod method, FinderPenalty finderPenalty) const {
+    if (method == PenaltyMethod::Reference) {
+        const unsigned int a = evaluateAdjacentSameColor();
+        const unsigned int b = evaluateSameColorBlocks();
+        const unsigned int c = evaluate11311Pattern(finderPenalty);
+        const unsigned int d = evaluateDarkProportion();
+        return a + b + c + d;
+    }
+    
+    const ModulePlane columns = transposed();
+    const unsigned int a = evaluateAdjacentSameColorBitboard(columns);
+    const unsigned int b = evaluateSameColorBlocksBitboard();
+    const unsigned int c = evaluate11311PatternRunLength(columns, finderPenalty);
     const unsigned int d = evaluateDarkProportion();
     return a + b + c + d;
 }
 
 
+/**
+ * Scores the penalty rules counting only runs, blocks and finder-like
+ * patterns made up entirely of the modules set in \a fixedModules, which keep
+ * their color with every mask and data. See PenaltyBounds. This runs once
+ * per version, so it examines one module at a time.
+ */
+Symbol::PenaltyBounds Symbol::evaluatePenaltyBounds(const std::vector<uint64_t> &fixedModules) const {
+    static constexpr unsigned int N2 = 3;
+    static constexpr unsigned int N3 = 40;
+    static constexpr int Border = 4;
+    static constexpr array<pair<bool, int>, 7> Pattern = {{
+        {false, 4}, {true, 1}, {false, 1}, {true, 3}, {false, 1}, {true, 1}, {false, 4}
+    }};
+    
+    // 1 for a fixed dark module, 0 for a fixed light one, -1 for any other;
+    // modules outside the symbol are light.
+    auto color = [&](int x, int y) -> int {
+        if (!valid(x, y)) { return 0; }
+        if (!((fixedModules[y * _stride + x / 64] >> (x % 64)) & 1)) { return -1; }
+        return module(x, y);
+    };
+    
+    PenaltyBounds result{};
+    
+    // N1: a run of L >= 5 fixed modules is part of a run of at least L
+    // modules, which scores at least N1 + L - 5 = L - 2.
+    for (int i = 0; i < _size; ++i) {
+        for (bool horizontal : { true, false }) {
+            int runColor = -1;
+            int run = 0;
+            for (int j = 0; j <= _size; ++j) {
+                const int c = j == _size ? -1 : horizontal ? color(j, i) : color(i, j);
+                if (c != -1 && c == runColor) {
+                    ++run;
+                    continue;
+                }
+                if (runColor != -1 && run >= 5) { result.adjacentSameColor += run - 2; }
+                runColor = c;
+                run = 1;
+            }
+        }
+    }
+    
+    // N2
+    for (int y = 0; y < _size - 1; ++y) {
+        for (int x = 0; x < _size - 1; ++x) {
+            const int c = color(x, y);
+            if (c != -1 && color(x + 1, y) == c && color(x, y + 1) == c && color(x + 1, y + 1) == c) {
+                result.sameColorBlocks += N2;
+            }
+        }
+    }
+    
+    // N3, at the positions and scales examined by evaluate11311Pattern().
+    // dark[p] and light[p] count the fixed modules of either color before
+    // position p of the line, which starts Border modules outside the symbol.
+    const int paddedSize = _size + 2 * Border;
+    vector<int> dark(paddedSize + 1);
+    vector<int> light(paddedSize + 1);
+    for (int i = 0; i < _size; ++i) {
+        for (bool horizontal : { true, false }) {
+            for (int p = 0; p < paddedSize; ++p) {
+                const int c = horizontal ? color(p - Border, i) : color(i, p - Border);
+                dark[p + 1] = dark[p] + (c == 1);
+                light[p + 1] = light[p] + (c == 0);
+            }
+            for (FinderPenalty finderPenalty : { FinderPenalty::Compatible, FinderPenalty::Strict }) {
+                const int maxScale = finderPenalty == FinderPenalty::Strict ? 1 : _size - i;
+                for (int scale = 1; 15 * scale < paddedSize && scale <= maxScale; ++scale) {
+                    for (int p = 0; p + 15 * scale <= paddedSize; ++p) {
+                        bool match = true;
+                        int q = p;
+                        for (const auto &[isDark, length] : Pattern) {
+                            const vector<int> &counts = isDark ? dark : light;
+                            match = match && counts[q + length * scale] - counts[q] == length * scale;
+                            q += length * scale;
+                        }
+                        if (match) { result.pattern11311[size_t(finderPenalty)] += N3; }
+                    }
+                }
+            }
+        }
+    }
+    
+    return result;
+}
+
+
 unsigned int Symbol::evaluateAdjacentSameColor() const {
     static constexpr unsigned int N1 = 3;
 
@@ -300,10 +674,10 @@ unsigned int Symbol::evaluateAdjacentSameColor() const {
 
     // find horizontally adjacent pixels of the same color
     for (int row = 0; row < _size; ++row) {
-        bool runColor = _pixels[toIndex(0, row)];
+        bool runColor = module(0, row);
         unsigned int run = 1;
         for (int col = 1; col < _size; ++col, ++run) {
-            const bool pixelColor = _pixels[toIndex(col, row)];
+            const bool pixelColor = module(col, row);
             if (runColor != pixelColor) {
                 if (run >= 5) { result += N1 + run - 5u; }
                 runColor = pixelColor;
@@ -315,10 +689,10 @@ unsigned int Symbol::evaluateAdjacentSameColor() const {
 
     // find vertically adjacent pixels of the same color
     for (int col = 0; col < _size; ++col) {
-        bool runColor = _pixels[toIndex(col, 0)];
+        bool runColor = module(col, 0);
         unsigned int run = 1;
         for (int row = 1; row < _size; ++row, ++run) {
-            const bool pixelColor = _pixels[toIndex(col, row)];
+            const bool pixelColor = module(col, row);
             if (runColor != pixelColor) {
                 if (run >= 5) { result += N1 + run - 5u; }
                 runColor = pixelColor;
@@ -340,10 +714,10 @@ unsigned int Symbol::evaluateSameColorBlocks() const {
     for (int row = 0; row < _size - 1; ++row) {
         for (int col = 0; col < _size - 1; ++col) {
             const array<bool, 4> colors = {
-                _pixels[toIndex(col, row)],
-                _pixels[toIndex(col + 1, row)],
-                _pixels[toIndex(col, row + 1)],
-                _pixels[toIndex(col + 1, row + 1)],
+                module(col, row),
+                module(col + 1, row),
+                module(col, row + 1),
+                module(col + 1, row + 1),
             };
 
             unsigned int score = N2;
@@ -362,7 +736,116 @@ unsigned int Symbol::evaluateSameColorBlocks() const {
 }
 
 
-unsigned int Symbol::evaluate11311Pattern() const {
+/**
+ * Bit x of the result is module 64 * \a i + x + \a shift of \a row, which has
+ * \a stride words; modules past the row's end are 0. \a shift must be < 64.
+ */
+static inline uint64_t shiftedWord(const uint64_t *row, size_t stride, size_t i, unsigned int shift) {
+    if (shift == 0) { return row[i]; }
+    const uint64_t next = i + 1 < stride ? row[i + 1] : 0;
+    return (row[i] >> shift) | (next << (64 - shift));
+}
+
+
+/** The bits of word \a i for the modules x < \a end. */
+static inline uint64_t bitsBelow(size_t i, size_t end) {
+    if (end <= 64 * i) { return 0; }
+    if (end >= 64 * (i + 1)) { return ~uint64_t{0}; }
+    return (uint64_t{1} << (end - 64 * i)) - 1;
+}
+
+
+/**
+ * The N1 penalty of a single row of \a size modules. A run of length L >= 5
+ * scores N1 + L - 5 = (L - 4) + 2 for N1 = 3, which is the number of 5 module
+ * windows of a single color within it, plus 2 for the window at its start.
+ */
+unsigned int Symbol::evaluateRuns(const uint64_t *row, size_t size) {
+    const size_t stride = (size + 63) / 64;
+    unsigned int result = 0;
+    for (size_t i = 0; i < stride; ++i) {
+        const uint64_t m0 = row[i];
+        const uint64_t m1 = shiftedWord(row, stride, i, 1);
+        const uint64_t m2 = shiftedWord(row, stride, i, 2);
+        const uint64_t m3 = shiftedWord(row, stride, i, 3);
+        const uint64_t m4 = shiftedWord(row, stride, i, 4);
+        const uint64_t window = ~(m0 ^ m1) & ~(m1 ^ m2) & ~(m2 ^ m3) & ~(m3 ^ m4) & bitsBelow(i, size - 4);
+        const uint64_t previous = (m0 << 1) | (i > 0 ? row[i - 1] >> 63 : 0);
+        const uint64_t runStart = (m0 ^ previous) | (i == 0 ? 1 : 0);
+        result += popcount(window) + 2 * popcount(window & runStart);
+    }
+    return result;
+}
+
+
+/** \a columns is the transposed module plane, see transposed(). */
+unsigned int Symbol::evaluateAdjacentSameColorBitboard(span<const uint64_t> columns) const {
+    unsigned int result = 0;
+    for (int y = 0; y < _size; ++y) {
+        result += evaluateRuns(&_modules[y * _stride], _size);
+        result += evaluateRuns(&columns[y * _stride], _size);
+    }
+    return result;
+}
+
+
+unsigned int Symbol::evaluateSameColorBlocksBitboard() const {
+    static constexpr unsigned int N2 = 3;
+    
+    unsigned int result = 0;
+    for (int y = 0; y < _size - 1; ++y) {
+        const uint64_t *row0 = &_modules[y * _stride];
+        const uint64_t *row1 = &_modules[(y + 1) * _stride];
+        for (size_t i = 0; i < _stride; ++i) {
+            const uint64_t vertical = ~(row0[i] ^ row1[i]);
+            const uint64_t verticalRight = ~(shiftedWord(row0, _stride, i, 1) ^ shiftedWord(row1, _stride, i, 1));
+            const uint64_t horizontal = ~(row0[i] ^ shiftedWord(row0, _stride, i, 1));
+            result += N2 * popcount(vertical & verticalRight & horizontal & bitsBelow(i, _size - 1));
+        }
+    }
+    return result;
+}
+
+
+/** Transposes the 64x64 bit matrix \a a in place, where bit x of a[y] is element (x, y). */
+static void transpose64(array<uint64_t, 64> &a) {
+    uint64_t m = 0x0000'0000'FFFF'FFFF;
+    for (unsigned int j = 32; j != 0; j >>= 1, m ^= m << j) {
+        for (unsigned int k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+            const uint64_t t = ((a[k] >> j) ^ a[k | j]) & m;
+            a[k | j] ^= t;
+            a[k] ^= t << j;
+        }
+    }
+}
+
+
+/**
+ * Returns a copy of the module plane with rows and columns swapped, in the
+ * same layout, so that columns can be processed a word at a time. Only the
+ * first size() * stride() words are set.
+ */
+Symbol::ModulePlane Symbol::transposed() const {
+    ModulePlane result;
+    array<uint64_t, 64> block;
+    for (size_t blockY = 0; blockY < _stride; ++blockY) {
+        for (size_t blockX = 0; blockX < _stride; ++blockX) {
+            for (size_t k = 0; k < 64; ++k) {
+                const size_t y = 64 * blockY + k;
+                block[k] = y < size_t(_size) ? _modules[y * _stride + blockX] : 0;
+            }
+            transpose64(block);
+            for (size_t k = 0; k < 64; ++k) {
+                const size_t x = 64 * blockX + k;
+                if (x < size_t(_size)) { result[x * _stride + blockY] = block[k]; }
+            }
+        }
+    }
+    return result;
+}
+
+
+unsigned int Symbol::evaluate11311Pattern(FinderPenalty finderPenalty) const {
     static constexpr unsigned int N3 = 40;
     static constexpr size_t PatLen{15};
     static constexpr bool w = false;
@@ -373,13 +856,14 @@ unsigned int Symbol::evaluate11311Pattern() const {
         if (col < 0 || int(_size) <= col || row < 0 || int(_size) <= row) {
             return w;
         } else {
-            return _pixels[toIndex(col, row)];
+            return module(col, row);
         }
     };
 
     size_t result = 0;
     
-    for (size_t scale = 1; int(scale * PatLen) < (_size + 8); ++scale) {
+    const size_t maxScale = finderPenalty == FinderPenalty::Strict ? 1 : _size;
+    for (size_t scale = 1; int(scale * PatLen) < (_size + 8) && scale <= maxScale; ++scale) {
         for (size_t i = 0; i <= _size - scale; ++i) {
             for (int j = -4; j <= int(_size) + 4 - int(scale * PatLen); ++j) {
                 // match horizontally
@@ -418,10 +902,72 @@ unsigned int Symbol::evaluate11311Pattern() const {
 }
 
 
+/**
+ * Scores the N3 rule with one pass over each row and column: the line is split
+ * into runs of a single color, and each dark run is checked for being the
+ * start of a s:s:3s:s:s dark:light:dark:light:dark sequence with enough light
+ * modules on either side. Equivalent to evaluate11311Pattern(). \a columns is
+ * the transposed module plane, see transposed().
+ */
+unsigned int Symbol::evaluate11311PatternRunLength(span<const uint64_t> columns,
+                                                   FinderPenalty finderPenalty) const {
+    unsigned int result = 0;
+    for (int i = 0; i < _size; ++i) {
+        result += evaluate11311Line(&_modules[i * _stride], _size, i, finderPenalty);
+        result += evaluate11311Line(&columns[i * _stride], _size, i, finderPenalty);
+    }
+    return result;
+}
+
+
+/** The N3 penalty of the row or column number \a lineNo, see evaluate11311PatternRunLength(). */
+unsigned int Symbol::evaluate11311Line(const uint64_t *line, size_t size, size_t lineNo,
+                                       FinderPenalty finderPenalty) {
+    static constexpr unsigned int N3 = 40;
+    static constexpr size_t Border = 4; ///< light modules outside the symbol which may be part of a pattern
+    
+    // Split the line into runs; the boundaries are where a module differs
+    // from the next one. Runs alternate in color, starting with module 0's.
+    array<uint8_t, 177> runs;
+    size_t runCount = 0;
+    const size_t stride = (size + 63) / 64;
+    size_t runStart = 0;
+    for (size_t i = 0; i < stride; ++i) {
+        uint64_t boundaries = (line[i] ^ shiftedWord(line, stride, i, 1)) & bitsBelow(i, size - 1);
+        while (boundaries != 0) {
+            const size_t x = 64 * i + countr_zero(boundaries);
+            runs[runCount++] = x + 1 - runStart;
+            runStart = x + 1;
+            boundaries &= boundaries - 1;
+        }
+    }
+    runs[runCount++] = size - runStart;
+    
+    const size_t maxScale = finderPenalty == FinderPenalty::Strict ? 1 : size - lineNo;
+    unsigned int result = 0;
+    for (size_t r = (line[0] & 1) ? 0 : 1; r + 5 <= runCount; r += 2) {
+        // runs[r] is dark
+        const size_t scale = runs[r];
+        if (scale > maxScale || 15 * scale >= size + 8) { continue; }
+        if (runs[r + 1] != scale || runs[r + 2] != 3 * scale || runs[r + 3] != scale || runs[r + 4] != scale) {
+            continue;
+        }
+        // The light runs before and after; at the symbol's edges, they are
+        // extended by the border.
+        const size_t lightBefore = r == 0 ? Border : runs[r - 1] + (r == 1 ? Border : 0);
+        const size_t lightAfter = r + 5 == runCount ? Border
+                                                    : runs[r + 5] + (r + 6 == runCount ? Border : 0);
+        if (lightBefore >= 4 * scale && lightAfter >= 4 * scale) { result += N3; }
+    }
+    return result;
+}
+
+
 unsigned int Symbol::evaluateDarkProportion() const {
     static constexpr unsigned int N4 = 10;
     
-    const size_t darkCount = count_if(_pixels.begin(), _pixels.end(), std::identity());
+    size_t darkCount = 0;
+    for (uint64_t word : _modules) { darkCount += popcount(word); }
     int darkProportion = 20 * darkCount / (_size * _size) - 10;
     if (2 * darkCount < (_size * _size)) { darkProportion += 1; }
     return abs(darkProportion) * N4;
@@ -443,22 +989,42 @@ bool Symbol::valid(int x, int y) const {
 }
 
 
+/**
+ * Sets the \a w modules starting at (\a x, \a y) to \a color, a word at a
+ * time. Modules outside the symbol are skipped.
+ */
+void Symbol::setModules(int x, int y, int w, bool color) {
+    if (y < 0 || y >= _size) { return; }
+    const int begin = max(x, 0);
+    const int end = min(x + w, _size);
+    uint64_t *row = &_modules[y * _stride];
+    for (int i = begin; i < end;) {
+        const int bit = i % 64;
+        const int count = min(end - i, 64 - bit);
+        const uint64_t mask = (count == 64 ? ~uint64_t{0} : (uint64_t{1} << count) - 1) << bit;
+        row[i / 64] = color ? row[i / 64] | mask : row[i / 64] & ~mask;
+        i += count;
+    }
+}
+
+
 void Symbol::drawPixel(int x, int y, bool color, PixelType pixelType) {
     if (valid(x, y)) {
-        size_t i = toIndex(x, y);
-        _pixels[i] = color;
-        _pixelType[i] = pixelType;
+        setModule(x, y, color);
+        _pixelType[toIndex(x, y)] = pixelType;
     }
 }
 
 
 void Symbol::drawRect(int x, int y, int w, int h, bool color, PixelType pixelType) {
-    for (int i = 0; i < w ; ++i) {
-        drawPixel(x + i, y, color, pixelType);
-        if (h != 1) {
-            drawPixel(x + i, y + h - 1, color, pixelType);
-        }
+    // top and bottom edge
+    for (int edgeY : { y, y + h - 1 }) {
+        if (edgeY < 0 || edgeY >= _size) { continue; }
+        setModules(x, edgeY, w, color);
+        for (int i = max(x, 0); i < min(x + w, _size); ++i) { _pixelType[toIndex(i, edgeY)] = pixelType; }
+        if (h == 1) { break; }
     }
+    // left and right edge
     for (int i = 1; i < h - 1; ++i) {
         drawPixel(x, y + i, color, pixelType);
         if (w != 1) {
@@ -468,27 +1034,17 @@ void Symbol::drawRect(int x, int y, int w, int h, bool color, PixelType pixelTyp
 }
 
 
-array<Symbol::Position, 8> Symbol::position(int codeword) {
+array<Symbol::Position, 8> Symbol::position(int codeword) const {
     array<Position, 8> result;
     result.fill({-1, -1, false});
-
-    if (codeword < 0) { return result; }
-
-    Position position(startPosition());
-
-    for (int i = 0; i < codeword; ++i) {
-        for (int j = 0; j < 8; ++j) {
-            position = nextPosition(position);
-            if (!position.valid()) { return result; }
-        }
-    }
-
-    for (int i = 0; i < 8; ++i) {
-        result[i] = position;
-        position = nextPosition(position);
-        if (!position.valid()) { return result; }
+    if (codeword < 0 || !_template) { return result; }
+    
+    const vector<uint16_t> &placement = _template->placement;
+    const size_t rowBits = 64 * _stride;
+    for (size_t i = 0; i < 8 && 8 * size_t(codeword) + i < placement.size(); ++i) {
+        const uint16_t bitIndex = placement[8 * codeword + i];
+        result[i] = Position{int(bitIndex % rowBits), int(bitIndex / rowBits), false};
     }
-
     return result;
 }
 
@@ -522,7 +1078,7 @@ Symbol::Position Symbol::nextPosition(Position position) const {
             }
         }
         
-    } while (position.valid() && !isDataPosition(_pixelType[toIndex(position)]));
+    } while (position.valid() && !isDataPosition(pixelType()[toIndex(position)]));
 
     return position;
 }
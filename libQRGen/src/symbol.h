@@ -9,7 +9,11 @@
 #define SYMBOL_H
 
 #include <array>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <memory_resource>
+#include <span>
 #include <vector>
 #include "qrgen.h"
 
@@ -22,12 +26,87 @@ public:
     enum class PixelType : uint8_t { Unset, Data, Blank, FinderPattern, Separator, TimingPattern,
                                      AlignmentPattern, FormatInformation, VersionInformation };
     
+    /**
+     * How the penalty scores of the data masks are calculated. All methods
+     * produce identical scores.
+     */
+    enum class PenaltyMethod : uint8_t {
+        /** Examine one module at a time. Kept for reference. */
+        Reference,
+        /**
+         * Examine runs and 2x2 blocks 64 modules at a time, with bitwise
+         * operations and popcount on the row words, and on the row words of
+         * a transposed copy for the columns. setData() scores the masks
+         * cheapest rule first and abandons those which can no longer have the
+         * lowest penalty, see maskStatistics().
+         */
+        Bitboard,
+        /**
+         * Evaluate all eight masks in a single pass, with each module stored
+         * as a byte holding its color for each mask (see MaskPenalties).
+         * Scoring a single mask with evaluate() falls back to Bitboard. Since
+         * all eight masks are always scored in full, this is slower than
+         * Bitboard with its pruning, so it is only used when requested.
+         */
+        BitSliced
+    };
+    
+    /**
+     * Which finder-like patterns (1:1:3:1:1 dark:light:dark:light:dark,
+     * with 4 light modules on either side) the N3 penalty rule counts. Both
+     * penalty methods support both rules. Modules outside the symbol count
+     * as light, as they are part of the quiet zone.
+     */
+    enum class FinderPenalty : uint8_t {
+        /**
+         * Patterns scaled by any factor s with 15s < size + 8, i.e. runs of
+         * s:s:3s:s:s modules with 4s light modules on either side, of which
+         * up to 4 may lie outside of the symbol. A pattern of scale s is
+         * only counted in rows and columns 0 to size - s. This reproduces
+         * the scores of earlier QRGen versions, so it is the default.
+         */
+        Compatible,
+        /** Patterns of single modules only, as in ISO/IEC 18004:2015. */
+        Strict
+    };
+    
+    /** How setData() selects the mask, if none is given. */
+    struct MaskPolicy {
+        QRGen_MaskSelection selection = QRGen_Mask_Exhaustive;
+        std::chrono::nanoseconds budget{0}; ///< the time mask selection may take with QRGen_Mask_Deadline
+        /**
+         * Heuristic and deadline selection score the masks one at a time, so
+         * with BitSliced they fall back to Bitboard.
+         */
+        PenaltyMethod penaltyMethod = PenaltyMethod::Bitboard;
+        FinderPenalty finderPenalty = FinderPenalty::Compatible;
+    };
+    
+    /**
+     * How setData() selected the mask. For a given mask, masksEvaluated and
+     * elapsed are 0.
+     */
+    struct MaskReport {
+        /**
+         * QRGen_Mask_Heuristic with the heuristic policy, QRGen_Mask_Deadline
+         * if the budget ran out, and QRGen_Mask_Exhaustive otherwise.
+         */
+        QRGen_MaskSelection selection;
+        uint8_t mask;
+        uint8_t masksEvaluated; ///< the number of masks scored or ruled out
+        std::chrono::nanoseconds elapsed;
+    };
+    
+    /** The most words modules() can have: 3 per row of a version 40 symbol. */
+    static constexpr size_t MaxModuleWords = 177 * 3;
+    
     /**
      * Create a symbol with the given \a version. Versions must be in the
      * range 1-40, otherwise the symbol will not be valid (size() will return
-     * 0).
+     * 0). The module plane is allocated from \a resource, which must outlive
+     * the symbol; it takes at most MaxModuleWords words.
      */
-    Symbol(uint8_t version);
+    Symbol(uint8_t version, std::pmr::memory_resource *resource = std::pmr::get_default_resource());
     
     /**
      * The symbol's size in pixels. This method returns a scalar which is
@@ -35,11 +114,24 @@ public:
      */
     size_t size() const;
     
-    /** Returns the pixel data, row by row. */
-    const std::vector<bool> pixels() const;
+    /**
+     * Returns the module plane, row by row, with stride() 64 bit words per
+     * row. Module (x, y) is bit x % 64 of word y * stride() + x / 64, set if
+     * the module is dark. Bits past the end of a row are always 0.
+     */
+    std::span<const uint64_t> modules() const;
+    
+    /** The number of 64 bit words per row in modules(). */
+    size_t stride() const;
     
-    /** Returns the pixel type, row by row. */
-    const std::vector<PixelType> pixelType() const;
+    /** Returns the words of row \a y, which must be in the range [0, size()). */
+    std::span<const uint64_t> row(int y) const;
+    
+    /**
+     * Returns the pixel type, row by row. The pixel types only depend on the
+     * version, so they are those of a symbol with data even before setData().
+     */
+    std::span<const PixelType> pixelType() const;
     
     /**
      * The value of the given pixel. The coordinates \a x and \a y must be
@@ -47,12 +139,86 @@ public:
      * returned.
      */
     bool pixel(int x, int y) const; 
+    
+    /**
+     * The highlight of the given pixel, as set with highlightCodeword(). 0 for
+     * pixels which were not highlighted.
+     */
     uint32_t highlight(int x, int y) const;
     
     void highlightCodeword(size_t codewordNo, uint32_t highlight);
-    void setData(const std::vector<uint8_t> &data, QRGen_ErrorCorrection ec, uint8_t mask = 255);
+    
+    /**
+     * Draws the codewords \a data with \a mask, or with the mask selected
+     * according to \a maskPolicy if \a mask is 255, and the format information.
+     */
+    void setData(std::span<const uint8_t> data, QRGen_ErrorCorrection ec, uint8_t mask,
+                 const MaskPolicy &maskPolicy);
+    void setData(std::span<const uint8_t> data, QRGen_ErrorCorrection ec, uint8_t mask = 255);
+    
+    /** How the mask was selected by the last call of setData(). */
+    const MaskReport &maskReport() const;
+    
+    /**
+     * How often setData() selected a mask by scoring masks one at a time,
+     * i.e. other than exhaustively with BitSliced, and how often each mask
+     * was abandoned before all penalty rules were scored, because its partial
+     * penalty could no longer beat the lowest one so far. Counted across all
+     * symbols and threads.
+     */
+    struct MaskStatistics {
+        uint64_t selections;
+        std::array<uint64_t, 8> pruned;
+    };
+    
+    static MaskStatistics maskStatistics();
+    static void resetMaskStatistics();
     
 private:
+    /**
+     * The penalties which the function patterns of a version incur by
+     * themselves, excluding the format information: runs, blocks and
+     * finder-like patterns consisting only of such modules. They are the same
+     * with every mask, so they are lower bounds for the penalty scores.
+     */
+    struct PenaltyBounds {
+        unsigned int adjacentSameColor;
+        unsigned int sameColorBlocks;
+        std::array<unsigned int, 2> pattern11311; ///< indexed by FinderPenalty
+    };
+    
+    /**
+     * The function patterns of a version: finder patterns with separators,
+     * timing patterns, alignment patterns, version information and the dark
+     * module, as well as the reserved format information area (drawn light).
+     * They only depend on the version, so they are drawn once per version and
+     * copied into each new Symbol.
+     */
+    struct Template {
+        std::vector<uint64_t> modules;
+        std::vector<uint64_t> functionModules; ///< set for modules which are not data modules
+        std::vector<PixelType> pixelType;
+        
+        /**
+         * The data modules in codeword placement order, as bit indices into
+         * the module plane (y * 64 * stride() + x). Data codeword n occupies
+         * entries 8n to 8n+7, most significant bit first; the entries after
+         * the last codeword are the remainder bits.
+         */
+        std::vector<uint16_t> placement;
+        
+        /**
+         * The modules inverted by each data mask, i.e. the mask pattern
+         * restricted to the data modules.
+         */
+        std::array<std::vector<uint64_t>, 8> maskPlanes;
+        
+        PenaltyBounds penaltyBounds;
+    };
+    
+    /** Room for the module plane of any version, for copies made while masking. */
+    using ModulePlane = std::array<uint64_t, MaxModuleWords>;
+    
     struct Position {
         int x;
         int y;
@@ -61,26 +227,53 @@ private:
         bool valid() const;
     };
 
+    Symbol(uint8_t version, const Template *functionPatterns, std::pmr::memory_resource *resource);
+    
+    /**
+     * The function pattern template for \a version, which must be in the
+     * range 1-40. Templates are built on first use and never modified
+     * afterwards, so they can be shared between threads.
+     */
+    static const Template &functionPatterns(uint8_t version);
+    
     void drawAlignmentPatterns();
-    void drawCodewords(const std::vector<uint8_t> &data, uint8_t mask);
+    void drawCodewords(std::span<const uint8_t> data);
+    void drawMask(std::span<const uint64_t> unmasked, uint8_t mask);
     void drawDarkModule();
     void drawFinderPatterns();
     void drawFormatInformation(uint8_t mask, QRGen_ErrorCorrection ec);
+    void drawFormatInformationArea();
     void drawTimingPatterns();
     void drawVersionInformation();
+    
+    void selectMask(std::span<const uint64_t> unmasked, QRGen_ErrorCorrection ec,
+                    const MaskPolicy &policy, MaskReport &report);
+    PenaltyBounds evaluatePenaltyBounds(const std::vector<uint64_t> &fixedModules) const;
 
-    unsigned int evaluate() const;
+    unsigned int evaluate(PenaltyMethod method = PenaltyMethod::Bitboard,
+                          FinderPenalty finderPenalty = FinderPenalty::Compatible) const;
     unsigned int evaluateAdjacentSameColor() const;
     unsigned int evaluateSameColorBlocks() const;
-    unsigned int evaluate11311Pattern() const;
+    unsigned int evaluateAdjacentSameColorBitboard(std::span<const uint64_t> columns) const;
+    unsigned int evaluateSameColorBlocksBitboard() const;
+    static unsigned int evaluateRuns(const uint64_t *row, size_t size);
+    ModulePlane transposed() const;
+    unsigned int evaluate11311Pattern(FinderPenalty finderPenalty = FinderPenalty::Compatible) const;
+    unsigned int evaluate11311PatternRunLength(std::span<const uint64_t> columns,
+                                               FinderPenalty finderPenalty = FinderPenalty::Compatible) const;
+    static unsigned int evaluate11311Line(const uint64_t *line, size_t size, size_t lineNo,
+                                          FinderPenalty finderPenalty);
     unsigned int evaluateDarkProportion() const;
         
     size_t toIndex(int x, int y) const;
     size_t toIndex(const Position &position) const;
     bool valid(int x, int y) const;
+    bool module(int x, int y) const;
+    void setModule(int x, int y, bool color);
+    void setModules(int x, int y, int w, bool color);
     void drawPixel(int x, int y, bool color, PixelType pixelType);
     void drawRect(int x, int y, int w, int h, bool color, PixelType pixelType);
-    std::array<Position, 8> position(int codeword);
+    std::array<Position, 8> position(int codeword) const;
     Position nextPosition(Position position) const;
     Position startPosition() const;
 
@@ -88,9 +281,25 @@ private:
     
     const int _version;
     const int _size;
-    std::vector<bool> _pixels;
-    std::vector<PixelType> _pixelType;
-    std::vector<uint32_t> _highlight;
+    const size_t _stride;
+    const Template *_template;
+    std::pmr::vector<uint64_t> _modules;
+    std::vector<PixelType> _pixelType; ///< empty if there is a template, see pixelType()
+    std::vector<uint32_t> _highlight; ///< empty until highlightCodeword() is called
+    MaskReport _maskReport{};
+
 };
 
+
+inline bool Symbol::module(int x, int y) const {
+    return (_modules[y * _stride + x / 64] >> (x % 64)) & 1;
+}
+
+
+inline void Symbol::setModule(int x, int y, bool color) {
+    uint64_t &word = _modules[y * _stride + x / 64];
+    const uint64_t bit = uint64_t{1} << (x % 64);
+    word = color ? word | bit : word & ~bit;
+}
+
 #endif // SYMBOL_H
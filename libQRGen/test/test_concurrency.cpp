@@ -0,0 +1,114 @@
+// Copyright 2024 Benjamin Lutz.
+// 
+// This file is part of QRGen. QRGen is free software: you can redistribute it
+// and/or modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "qrgen.h"
+#define private public
+#include "../src/qr.h"
+
+using namespace std;
+
+
+namespace {
+
+struct Job {
+    string text;
+    QRGen_ErrorCorrection ec;
+    uint8_t mask;
+    vector<uint64_t> expected;
+};
+
+
+/**
+ * Create one job per version and error correction level, with as much
+ * numeric data as fits into the version. The masks are fixed, because
+ * evaluating all of them would dominate the runtime.
+ */
+vector<Job> createJobs() {
+    vector<Job> jobs;
+    for (uint8_t version = 1; version <= 40; ++version) {
+        for (QRGen_ErrorCorrection ec : { QRGen_EC_L, QRGen_EC_M, QRGen_EC_Q, QRGen_EC_H }) {
+            string text;
+            for (size_t i = 0; i < QR::characterCapacity(QR::Mode::numeric, ec, version); ++i) {
+                text.push_back('0' + (i * 7 + version + ec) % 10);
+            }
+            jobs.push_back({text, ec, uint8_t(jobs.size() % 8), {}});
+        }
+    }
+    return jobs;
+}
+
+
+vector<uint64_t> encode(const Job &job) {
+    const Symbol symbol = QR::encode(job.text, job.ec, 0, job.mask);
+    return { symbol.modules().begin(), symbol.modules().end() };
+}
+
+} // namespace
+
+
+TEST(Concurrency, allVersionsAndErrorCorrectionLevels) {
+    static constexpr unsigned int Rounds = 8;
+    
+    vector<Job> jobs = createJobs();
+    
+    // The threads start before anything has been encoded, so that the shared
+    // tables of every version are built while other threads need them too.
+    // Each thread keeps what it encoded in the first round, and checks the
+    // later rounds against that.
+    const unsigned int threadCount = max(4u, thread::hardware_concurrency());
+    vector<vector<vector<uint64_t>>> firstRound(threadCount, vector<vector<uint64_t>>(jobs.size()));
+    atomic<bool> start{false};
+    atomic<unsigned int> failures{0};
+    vector<thread> threads;
+    for (unsigned int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&, t]() {
+            while (!start.load(memory_order_acquire)) { this_thread::yield(); }
+            // every thread starts with a different job, so that different
+            // versions are encoded at the same time.
+            for (size_t i = 0; i < Rounds * jobs.size(); ++i) {
+                const size_t j = (i + t * jobs.size() / threadCount) % jobs.size();
+                vector<uint64_t> modules = encode(jobs[j]);
+                if (i < jobs.size()) {
+                    firstRound[t][j] = move(modules);
+                } else if (modules != firstRound[t][j]) {
+                    failures.fetch_add(1, memory_order_relaxed);
+                }
+            }
+        });
+    }
+    start.store(true, memory_order_release);
+    for (thread &thread : threads) { thread.join(); }
+    
+    EXPECT_EQ(0u, failures.load());
+    
+    // the references are encoded only now, with all threads done
+    for (Job &job : jobs) {
+        job.expected = encode(job);
+        ASSERT_FALSE(job.expected.empty());
+    }
+    for (unsigned int t = 0; t < threadCount; ++t) {
+        for (size_t j = 0; j < jobs.size(); ++j) {
+            EXPECT_TRUE(firstRound[t][j] == jobs[j].expected) << "thread " << t << ", job " << j;
+        }
+    }
+    
+    // check that all versions are covered
+    vector<size_t> sizes;
+    for (const Job &job : jobs) { sizes.push_back(job.expected.size()); }
+    for (size_t version = 1; version <= 40; ++version) {
+        const size_t width = 17 + 4 * version;
+        const size_t stride = (width + 63) / 64;
+        EXPECT_NE(find(sizes.begin(), sizes.end(), width * stride), sizes.end());
+    }
+}
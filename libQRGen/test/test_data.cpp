@@ -6,6 +6,9 @@
 // or (at your option) any later version.
 
 #include <gtest/gtest.h>
+#include <span>
+#include <stdexcept>
+#include <vector>
 #define private public
 #include "../src/data.h"
 
@@ -117,6 +120,10 @@ TEST(Data, padLastByte) {
     EXPECT_EQ(data.bitCount(), 16);
     EXPECT_EQ(data.at(0), 0x80);
     EXPECT_EQ(data.at(1), 0xC0);
+    
+    // nothing to fill up
+    data.padLastByte();
+    EXPECT_EQ(data.bitCount(), 16);
 }
 
 
@@ -144,3 +151,64 @@ TEST(Data, appendZeros) {
     EXPECT_EQ(data.size(), 2);
     EXPECT_EQ(data.bitCount(), 16);
 }
+
+
+TEST(Data, appendLong) {
+    // append data of several words at every bit offset, and compare with
+    // appending bit by bit
+    Data other;
+    for (uint32_t i = 0; i < 100; ++i) { other.append(7, i * 37); }
+    
+    for (size_t offset = 0; offset < 16; ++offset) {
+        Data data;
+        data.append(offset, 0x5A5A);
+        Data expected = data;
+        data.append(other);
+        for (size_t i = 0; i < other.bitCount(); ++i) {
+            expected.append(1, other.at(i / 8) >> (7 - i % 8));
+        }
+        EXPECT_EQ(data, expected) << offset;
+        
+        // to itself
+        expected.append(expected);
+        data.append(data);
+        EXPECT_EQ(data.bitCount(), 2 * (offset + other.bitCount()));
+        EXPECT_EQ(data, expected) << offset;
+    }
+}
+
+
+TEST(Data, appendBytes) {
+    // lengths around the 8 bytes read at once, at every bit offset, from a
+    // buffer of exactly that length
+    for (size_t length : { 0, 1, 7, 8, 9, 15, 16, 100 }) {
+        std::vector<uint8_t> bytes(length);
+        for (size_t i = 0; i < length; ++i) { bytes[i] = uint8_t(i * 151 + 7); }
+        for (size_t offset = 0; offset < 8; ++offset) {
+            Data data;
+            data.append(offset, 0x5A);
+            Data expected = data;
+            data.append(std::span<const uint8_t>(bytes));
+            for (uint8_t byte : bytes) { expected.append(8, byte); }
+            EXPECT_EQ(data, expected) << length << " " << offset;
+        }
+    }
+}
+
+
+TEST(Data, capacity) {
+    Data data;
+    for (uint32_t i = 0; i < Data::Capacity; ++i) { data.append(8, i); }
+    EXPECT_EQ(data.size(), Data::Capacity);
+    EXPECT_EQ(data.at(Data::Capacity - 1), uint8_t(Data::Capacity - 1));
+    EXPECT_THROW(data.append(1, 1), std::length_error);
+    EXPECT_THROW(data.append(Data{1}), std::length_error);
+    EXPECT_EQ(data.bitCount(), 8 * Data::Capacity);
+    
+    // a copy is independent of the original
+    Data copy = data;
+    data.clear();
+    EXPECT_EQ(copy.size(), Data::Capacity);
+    EXPECT_EQ(copy.at(0), 0);
+    EXPECT_EQ(copy.at(1), 1);
+}
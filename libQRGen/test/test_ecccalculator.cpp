@@ -6,9 +6,12 @@
 // or (at your option) any later version.
 
 #include <gtest/gtest.h>
+#include <map>
+#include <set>
 #include <vector>
 #define private public
 #include "../src/ecccalculator.h"
+#include "../src/qr.h"
 
 using namespace std;
 
@@ -40,8 +43,128 @@ TEST(ECCCalculator, eccCalculation) {
 }
 
 
+TEST(ECCCalculator, methods) {
+    // All methods must produce the same codewords as Method::Reference, both
+    // when fed one codeword at a time and when fed in bulk. Methods which the
+    // CPU does not support fall back to one which it does.
+    using Method = ECCCalculator::Method;
+    
+    vector<uint8_t> data;
+    for (size_t i = 0; i < 200; ++i) { data.push_back(i * 151 + (i >> 3)); }
+    
+    for (size_t degree = 1; degree <= ECCCalculator::MaxDegree; ++degree) {
+        ECCCalculator reference{degree, Method::Reference};
+        reference.feed(data.data(), data.data() + data.size());
+        for (Method method : { Method::Table, Method::SSSE3, Method::GFNI, Method::Best }) {
+            ECCCalculator single{degree, method};
+            ECCCalculator bulk{degree, method};
+            for (uint8_t value : data) { single.feed(value); }
+            bulk.feed(data.data(), data.data() + 100);
+            bulk.feed(data.data() + 100, data.data() + data.size());
+            EXPECT_EQ(reference.errorCodeWords(), single.errorCodeWords())
+                << "degree " << degree << ", method " << int(single.method());
+            EXPECT_EQ(reference.errorCodeWords(), bulk.errorCodeWords())
+                << "degree " << degree << ", method " << int(bulk.method());
+        }
+    }
+}
+
+
+TEST(ECCCalculator, feedBlocks) {
+    // Batches must produce the same codewords as feeding each block, also
+    // when the block count is not a multiple of the lane count.
+    using Method = ECCCalculator::Method;
+    
+    for (size_t blockCount : { 1, 15, 16, 17, 40 }) {
+        const size_t dataCount = 23;
+        vector<vector<uint8_t>> data(blockCount);
+        vector<const uint8_t*> blocks;
+        for (size_t block = 0; block < blockCount; ++block) {
+            for (size_t i = 0; i < dataCount; ++i) { data[block].push_back(i * 151 + block * 29 + 3); }
+            blocks.push_back(data[block].data());
+        }
+        for (size_t degree = 1; degree <= ECCCalculator::MaxDegree; ++degree) {
+            for (Method method : { Method::Reference, Method::Table, Method::SSSE3, Method::GFNI }) {
+                vector<vector<uint8_t>> ecc(blockCount, vector<uint8_t>(degree));
+                vector<uint8_t*> remainders;
+                for (vector<uint8_t> &r : ecc) { remainders.push_back(r.data()); }
+                ECCCalculator::feedBlocks(blocks.data(), remainders.data(), blockCount, dataCount, degree, method);
+                for (size_t block = 0; block < blockCount; ++block) {
+                    EXPECT_EQ(ECCCalculator::feed(data[block].begin(), data[block].end(), degree), ecc[block])
+                        << blockCount << " blocks, degree " << degree << ", block " << block
+                        << ", method " << int(method);
+                }
+            }
+        }
+    }
+}
+
+
+TEST(ECCCalculator, syndromes) {
+    // A block of data codewords followed by its error correction codewords
+    // forms a polynomial which has α⁰, α¹, ..., αⁿ⁻¹ as roots.
+    using GFQR = ECCCalculator::GFQR;
+    
+    for (size_t degree = 1; degree <= ECCCalculator::MaxDegree; ++degree) {
+        vector<uint8_t> codewords;
+        for (size_t i = 0; i < 40; ++i) { codewords.push_back(i * 37 + degree * 11); }
+        const vector<uint8_t> ecCodewords =
+            ECCCalculator::feed(codewords.begin(), codewords.end(), degree);
+        codewords.insert(codewords.end(), ecCodewords.begin(), ecCodewords.end());
+        
+        for (size_t root = 0; root < degree; ++root) {
+            GFQR::Element syndrome = GFQR::zero();
+            for (uint8_t cw : codewords) { syndrome = syndrome * GFQR::alpha(root) + GFQR::Element{cw}; }
+            EXPECT_EQ(GFQR::zero(), syndrome) << "degree " << degree << ", root α^" << root;
+        }
+    }
+}
+
+
 TEST(ECCCalculator, polynomialGeneration) {
-    const vector<uint8_t> &p7 = ECCCalculator::generatorPolynomial(7);
-    vector<uint8_t> expected{21, 102, 238, 149, 146, 229, 87};
-    EXPECT_EQ(expected, p7);
+    // These are the generator polynomials from Annex A of ISO/IEC 18004:2015,
+    // as powers of alpha, lowest order first.
+    static const map<size_t, vector<uint8_t>> expectedPolynomials = {
+        { 7, { 21, 102, 238, 149, 146, 229, 87 }},
+        { 10, { 45, 32, 94, 64, 70, 118, 61, 46, 67, 251 }},
+        { 13, { 78, 140, 206, 218, 130, 104, 106, 100, 86, 100, 176, 152, 74 }},
+        { 15, { 105, 99, 5, 124, 140, 237, 58, 58, 51, 37, 202, 91, 61, 183, 8 }},
+        { 16, { 120, 225, 194, 182, 169, 147, 191, 91, 3, 76, 161, 102, 109, 107, 104, 120 }},
+        { 17, { 136, 163, 243, 39, 150, 99, 24, 147, 214, 206, 123, 239, 43, 78, 206, 139, 43 }},
+        { 18, { 153, 96, 98, 5, 179, 252, 148, 152, 187, 79, 170, 118, 97, 184, 94, 158, 234, 215 }},
+        { 20, { 190, 188, 212, 212, 164, 156, 239, 83, 225, 221, 180, 202, 187, 26, 163, 61, 50,
+                79, 60, 17 }},
+        { 22, { 231, 165, 105, 160, 134, 219, 80, 98, 172, 8, 74, 200, 53, 221, 109, 14, 230, 93,
+                242, 247, 171, 210 }},
+        { 24, { 21, 227, 96, 87, 232, 117, 0, 111, 218, 228, 226, 192, 152, 169, 180, 159, 126,
+                251, 117, 211, 48, 135, 121, 229 }},
+        { 26, { 70, 218, 145, 153, 227, 48, 102, 13, 142, 245, 21, 161, 53, 165, 28, 111, 201,
+                145, 17, 118, 182, 103, 2, 158, 125, 173 }},
+        { 28, { 123, 9, 37, 242, 119, 212, 195, 42, 87, 245, 43, 21, 201, 232, 27, 205, 147, 195,
+                190, 110, 180, 108, 234, 224, 104, 200, 223, 168 }},
+        { 30, { 180, 192, 40, 238, 216, 251, 37, 156, 130, 224, 193, 226, 173, 42, 125, 222, 96,
+                239, 86, 110, 48, 50, 182, 179, 31, 216, 152, 145, 173, 41 }},
+    };
+    using GFQR = ECCCalculator::GFQR;
+    
+    for (const auto &[degree, expected] : expectedPolynomials) {
+        const span<const uint8_t> polynomial = ECCCalculator::generatorPolynomial(degree);
+        vector<uint8_t> actual;
+        for (uint8_t coefficient : polynomial) { actual.push_back(GFQR::logAlpha(coefficient)); }
+        EXPECT_EQ(expected, actual) << "degree " << degree;
+    }
+    
+    // check that all degrees used by QR codes are covered
+    set<size_t> usedDegrees;
+    for (const auto &version : QR::ecBlocks) {
+        for (const auto &ecLevel : version) {
+            for (const auto &block : ecLevel) {
+                if (block[0] > 0) { usedDegrees.insert(block[1] - block[2]); }
+            }
+        }
+    }
+    for (size_t degree : usedDegrees) {
+        EXPECT_NE(expectedPolynomials.find(degree), expectedPolynomials.end()) << "degree " << degree;
+        EXPECT_LE(degree, ECCCalculator::MaxDegree);
+    }
 }
@@ -156,3 +156,13 @@ TEST(GF256, multiplicationQR) {
         }
     }
 }
+
+
+TEST(GF256, multiplicationByZeroQR) {
+    using GF = GF256<GF256_RP::QR>;
+    
+    for (unsigned i = 0; i < 256; ++i) {
+        EXPECT_EQ(GF::zero(), GF::Element(i) * GF::zero());
+        EXPECT_EQ(GF::zero(), GF::zero() * GF::Element(i));
+    }
+}
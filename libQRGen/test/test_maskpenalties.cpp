@@ -0,0 +1,101 @@
+// Copyright 2024 Benjamin Lutz.
+// 
+// This file is part of QRGen. QRGen is free software: you can redistribute it
+// and/or modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include "qrgen.h"
+#define private public
+#include "../src/maskpenalties.h"
+#include "../src/symbol.h"
+
+
+namespace {
+
+using FinderPenalty = Symbol::FinderPenalty;
+using PenaltyMethod = Symbol::PenaltyMethod;
+
+/** The eight masked variants of \a symbol's data, and their scores with Bitboard. */
+void maskedVariants(Symbol &symbol, const std::vector<uint8_t> &data, FinderPenalty finderPenalty,
+                    MaskPenalties::Planes &planes, MaskPenalties::Scores &scores) {
+    symbol.drawCodewords(data);
+    const std::vector<uint64_t> unmasked(symbol._modules.begin(), symbol._modules.end());
+    for (uint8_t mask = 0; mask < 8; ++mask) {
+        symbol.drawMask(unmasked, mask);
+        symbol.drawFormatInformation(mask, QRGen_EC_M);
+        planes[mask].assign(symbol._modules.begin(), symbol._modules.end());
+        scores[mask] = symbol.evaluate(PenaltyMethod::Bitboard, finderPenalty);
+    }
+}
+
+} // namespace
+
+
+TEST(MaskPenalties, scores) {
+    for (uint8_t version = 1; version <= 40; ++version) {
+        Symbol symbol(version);
+        std::vector<uint8_t> data(symbol.size() * symbol.size() / 8);
+        for (size_t i = 0; i < data.size(); ++i) { data[i] = i % 89 < 30 ? 0xFF : i * 167 + 13; }
+        
+        for (FinderPenalty finderPenalty : { FinderPenalty::Compatible, FinderPenalty::Strict }) {
+            MaskPenalties::Planes planes;
+            MaskPenalties::Scores expected;
+            maskedVariants(symbol, data, finderPenalty, planes, expected);
+            EXPECT_EQ(expected, MaskPenalties::evaluate(planes, symbol.size(), finderPenalty))
+                << "version " << int(version) << ", rule " << int(finderPenalty);
+        }
+    }
+}
+
+
+TEST(MaskPenalties, scaledFinderPatterns) {
+    // Each plane holds finder-like patterns of a different scale, in rows
+    // and, by symmetry, columns.
+    for (uint8_t version : { 1, 7, 20, 40 }) {
+        Symbol symbol(version);
+        const int size = symbol.size();
+        MaskPenalties::Planes planes;
+        MaskPenalties::Scores expected;
+        for (int k = 0; k < 8; ++k) {
+            const int scale = 1 + k % 4;
+            std::fill(symbol._modules.begin(), symbol._modules.end(), 0);
+            for (int y = 0; y < size; y += 2 + k) {
+                int x = (y * 7 + k) % 9 - 4;
+                while (x + 15 * scale <= size + 4) {
+                    x += 4 * scale;
+                    for (auto [run, dark] : { std::pair{1, true}, {1, false}, {3, true}, {1, false}, {1, true} }) {
+                        symbol.setModules(x, y, run * scale, dark);
+                        symbol.setModules(y, x, 1, dark);
+                        x += run * scale;
+                    }
+                    x += (y + k) % 3;
+                }
+            }
+            planes[k].assign(symbol._modules.begin(), symbol._modules.end());
+            expected[k] = symbol.evaluate(PenaltyMethod::Reference, FinderPenalty::Compatible);
+        }
+        EXPECT_EQ(expected, MaskPenalties::evaluate(planes, size, FinderPenalty::Compatible))
+            << "version " << int(version);
+    }
+}
+
+
+TEST(MaskPenalties, setData) {
+    // The bit-sliced mask search chooses the same mask as the others
+    for (uint8_t version = 1; version <= 40; version += 3) {
+        Symbol bitboard(version);
+        Symbol bitSliced(version);
+        std::vector<uint8_t> data(bitboard.size() * bitboard.size() / 8);
+        for (size_t i = 0; i < data.size(); ++i) { data[i] = i * 31 + version; }
+        bitboard.setData(data, QRGen_EC_H, 255, {.penaltyMethod = PenaltyMethod::Bitboard});
+        bitSliced.setData(data, QRGen_EC_H, 255, {.penaltyMethod = PenaltyMethod::BitSliced});
+        EXPECT_TRUE(std::ranges::equal(bitboard.modules(), bitSliced.modules())) << "version " << int(version);
+    }
+    
+    // It is opt-in, the pruning Bitboard method is faster
+    EXPECT_EQ(PenaltyMethod::Bitboard, Symbol::MaskPolicy{}.penaltyMethod);
+}
@@ -6,14 +6,22 @@
 // or (at your option) any later version.
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <string_view>
 #include "qrgen.h"
 #define private public
 #include "../src/qr.h"
+#include "../src/kanjitable.h"
 
 
 TEST(QR, encodeSegment) {
     // This is the example from Annex I of ISO 18004:2015.
-    QR::EncodeResult result = QR::encodeSegment(u"01234567", QRGen_EC_M);
+    const QR::Segmentation segmentation = QR::segment("01234567", QRGen_EC_M);
+    ASSERT_TRUE(segmentation.success);
+    EXPECT_EQ(1, segmentation.version);
+    const Data bits = QR::encodeSegments(segmentation, QRGen_EC_M);
     Data expected;
     expected.append(4, 0b0001);
     expected.append(10, 0b0000001000);
@@ -22,8 +30,79 @@ TEST(QR, encodeSegment) {
     expected.append(7, 0b1000011);
     expected.append(4, 0b0000);
     
-    EXPECT_EQ(result.bits.bitCount(), expected.bitCount());
-    EXPECT_EQ(result.bits, expected);
+    EXPECT_EQ(bits.bitCount(), expected.bitCount());
+    EXPECT_EQ(bits, expected);
+}
+
+
+TEST(QR, appendPadding) {
+    // The data codewords of the example from Annex I of ISO 18004:2015: the
+    // 45 bits are padded with 0 bits to a byte boundary, then with the pad
+    // codewords.
+    Data bits = QR::encodeSegments(QR::segment("01234567", QRGen_EC_M), QRGen_EC_M);
+    QR::appendPadding(bits, 1, QRGen_EC_M);
+    const std::vector<uint8_t> expected = { 0x10, 0x20, 0x0C, 0x56, 0x61, 0x80, 0xEC, 0x11,
+                                            0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11 };
+    EXPECT_EQ(bits.bitCount(), 8 * expected.size());
+    EXPECT_TRUE(std::ranges::equal(bits.data(), expected));
+    
+    // "1" ends at bit 22, and an odd number of pad codewords fills version 1-L
+    bits = QR::encodeSegments(QR::segment("1", QRGen_EC_L), QRGen_EC_L);
+    EXPECT_EQ(bits.bitCount(), 22u);
+    QR::appendPadding(bits, 1, QRGen_EC_L);
+    ASSERT_EQ(bits.bitCount(), 19u * 8);
+    EXPECT_EQ(bits.at(0), 0x10);
+    EXPECT_EQ(bits.at(1), 0x04);
+    EXPECT_EQ(bits.at(2), 0x40);
+    for (size_t i = 3; i < 19; ++i) { EXPECT_EQ(bits.at(i), i % 2 == 1 ? 0xEC : 0x11) << i; }
+}
+
+
+TEST(QR, segment) {
+    // a numeric run within alphanumeric text
+    QR::Segmentation segmentation = QR::segment("HTTPS://EX.COM/P/000123456789", QRGen_EC_M);
+    ASSERT_TRUE(segmentation.success);
+    ASSERT_EQ(2u, segmentation.segmentCount);
+    EXPECT_EQ(QR::Mode::alphanumeric, segmentation.segments[0].mode);
+    EXPECT_EQ("HTTPS://EX.COM/P/", segmentation.segments[0].data);
+    EXPECT_EQ(QR::Mode::numeric, segmentation.segments[1].mode);
+    EXPECT_EQ("000123456789", segmentation.segments[1].data);
+    // 4 + 9 + 8 * 11 + 6 alphanumeric, 4 + 10 + 4 * 10 numeric, 4 terminator
+    // bits, instead of 4 + 9 + 14 * 11 + 6 + 4 in one segment
+    EXPECT_EQ(165u, QR::encodeSegments(segmentation, QRGen_EC_M).bitCount());
+    
+    // a numeric run only pays off if it saves more than two segment headers
+    segmentation = QR::segment("a1234567890123b", QRGen_EC_M);
+    ASSERT_EQ(3u, segmentation.segmentCount);
+    EXPECT_EQ(QR::Mode::eightbit, segmentation.segments[0].mode);
+    EXPECT_EQ(QR::Mode::numeric, segmentation.segments[1].mode);
+    EXPECT_EQ(QR::Mode::eightbit, segmentation.segments[2].mode);
+    EXPECT_EQ(1u, QR::segment("a1234b", QRGen_EC_M).segmentCount);
+    
+    // UTF-8 byte segments count bytes, behind a single ECI header
+    segmentation = QR::segment("€ 123456789012345678", QRGen_EC_M);
+    ASSERT_TRUE(segmentation.utf8);
+    ASSERT_EQ(2u, segmentation.segmentCount);
+    EXPECT_EQ("€ ", segmentation.segments[0].data);
+    EXPECT_EQ(4u + 8 + (4 + 8 + 4 * 8) + (4 + 10 + 6 * 10) + 4,
+              QR::encodeSegments(segmentation, QRGen_EC_M).bitCount());
+    
+    // character count indicators are wider from version 10 on
+    segmentation = QR::segment("a", QRGen_EC_M, 10);
+    EXPECT_EQ(10, segmentation.version);
+    EXPECT_EQ(4u + 16 + 8 + 4, QR::encodeSegments(segmentation, QRGen_EC_M).bitCount());
+    
+    // the segments of a long string are joined again
+    std::string text;
+    for (size_t i = 0; i < 2000; ++i) { text.push_back('a' + i % 26); }
+    segmentation = QR::segment(text, QRGen_EC_L);
+    ASSERT_EQ(1u, segmentation.segmentCount);
+    EXPECT_EQ(text, segmentation.segments[0].data);
+    
+    // input longer than the densest capacity is rejected before segmenting
+    EXPECT_TRUE(QR::segment(std::string(QR::MaxInputSize, '7'), QRGen_EC_L).success);
+    EXPECT_FALSE(QR::segment(std::string(QR::MaxInputSize + 1, '7'), QRGen_EC_L).success);
+    EXPECT_FALSE(QR::segment(std::string(size_t{1} << 26, 'a'), QRGen_EC_L).success);
 }
 
 
@@ -33,4 +112,268 @@ TEST(QR, tables) {
     
     EXPECT_EQ(QR::ecBlocks[0][0][0][2], 19);
     EXPECT_EQ(QR::ecBlocks[0][0][1][2], 0);
+    
+    // the codeword counts agree with the error correction blocks
+    for (size_t version = 1; version <= 40; ++version) {
+        for (size_t ec = 0; ec < 4; ++ec) {
+            size_t dataCodewords = 0;
+            size_t ecCodewords = 0;
+            for (const std::array<uint16_t, 3> &blocks : QR::ecBlocks[version - 1][ec]) {
+                dataCodewords += blocks[0] * blocks[2];
+                ecCodewords += blocks[0] * (blocks[1] - blocks[2]);
+            }
+            EXPECT_EQ(8 * dataCodewords, QR::dataBitsCounts[version - 1][ec]) << version << " " << ec;
+            EXPECT_EQ(ecCodewords, QR::ecCodewordsCounts[version - 1][ec]) << version << " " << ec;
+        }
+    }
+}
+
+
+TEST(QR, characterCapacity) {
+    // some of table 7 of ISO/IEC 18004:2015
+    EXPECT_EQ(41, QR::characterCapacity(QR::Mode::numeric, QRGen_EC_L, 1));
+    EXPECT_EQ(25, QR::characterCapacity(QR::Mode::alphanumeric, QRGen_EC_L, 1));
+    EXPECT_EQ(17, QR::characterCapacity(QR::Mode::eightbit, QRGen_EC_L, 1));
+    EXPECT_EQ(10, QR::characterCapacity(QR::Mode::kanji, QRGen_EC_L, 1));
+    EXPECT_EQ(255, QR::characterCapacity(QR::Mode::numeric, QRGen_EC_L, 5));
+    EXPECT_EQ(106, QR::characterCapacity(QR::Mode::eightbit, QRGen_EC_L, 5));
+    EXPECT_EQ(7089, QR::characterCapacity(QR::Mode::numeric, QRGen_EC_L, 40));
+    EXPECT_EQ(4296, QR::characterCapacity(QR::Mode::alphanumeric, QRGen_EC_L, 40));
+    EXPECT_EQ(2953, QR::characterCapacity(QR::Mode::eightbit, QRGen_EC_L, 40));
+    EXPECT_EQ(1817, QR::characterCapacity(QR::Mode::kanji, QRGen_EC_L, 40));
+    EXPECT_EQ(784, QR::characterCapacity(QR::Mode::kanji, QRGen_EC_H, 40));
+    
+    // text filling a version to capacity gets that version, one more
+    // character the next, also where the character count indicators widen
+    const std::pair<QR::Mode, const char *> characters[] = {
+        { QR::Mode::numeric, "7" }, { QR::Mode::alphanumeric, "A" }, { QR::Mode::eightbit, "a" },
+        { QR::Mode::kanji, "点" } };
+    for (const auto &[mode, character] : characters) {
+        for (QRGen_ErrorCorrection ec : { QRGen_EC_L, QRGen_EC_M, QRGen_EC_Q, QRGen_EC_H }) {
+            for (uint8_t version : { 1, 8, 9, 10, 25, 26, 27, 39, 40 }) {
+                std::string text;
+                for (size_t i = 0; i < QR::characterCapacity(mode, ec, version); ++i) { text += character; }
+                QR::Segmentation segmentation = QR::segment(text, ec);
+                EXPECT_EQ(version, segmentation.version) << text.size() << " " << ec;
+                ASSERT_EQ(1u, segmentation.segmentCount);
+                EXPECT_EQ(mode, segmentation.segments[0].mode);
+                
+                text += character;
+                segmentation = QR::segment(text, ec);
+                EXPECT_EQ(version < 40 ? version + 1 : 0, segmentation.version) << text.size() << " " << ec;
+            }
+        }
+    }
+}
+
+
+TEST(QR, classify) {
+    EXPECT_EQ(QR::Mode::numeric, QR::classify("0123456789"));
+    EXPECT_EQ(QR::Mode::alphanumeric, QR::classify("HTTPS://EXAMPLE.COM/$%*+-. 0"));
+    EXPECT_EQ(QR::Mode::eightbit, QR::classify("https://example.com/?a=1&b=2"));
+    EXPECT_EQ(QR::Mode::eightbit, QR::classify("ÄÖÜ äöü ß ÿ \x7F"));
+    EXPECT_EQ(QR::Mode::eci, QR::classify("0123Ā"));
+    EXPECT_EQ(QR::Mode::eci, QR::classify("€"));
+    EXPECT_EQ(QR::Mode::eci, QR::classify("\u0085"));
+    EXPECT_EQ(QR::Mode::eci, QR::classify("line\nbreak"));
+    EXPECT_EQ(QR::Mode::eci, QR::classify("Produkt 商品 🙂"));
+    EXPECT_EQ(QR::Mode::kanji, QR::classify("商品コード"));
+    EXPECT_EQ(QR::Mode::eci, QR::classify("Produkt 商品"));
+    
+    // malformed UTF-8: continuation bytes, truncated, overlong, surrogate and
+    // beyond U+10FFFF
+    for (const char *invalid : { "\x80", "ab\xBF", "\xC3", "abcdefgh\xE2\x82", "\xC0\x80", "\xE0\x9F\xBF",
+                                 "\xED\xA0\x80", "\xF4\x90\x80\x80", "\xF8\x88\x80\x80\x80" }) {
+        EXPECT_EQ(QR::Mode::terminator, QR::classify(invalid)) << invalid;
+    }
+    
+    // every character below U+0100 alone, and in an ASCII run
+    for (char32_t c = 0; c < 0x100; ++c) {
+        std::string s;
+        if (c < 0x80) {
+            s.push_back(c);
+        } else {
+            s.push_back(0xC0 | (c >> 6));
+            s.push_back(0x80 | (c & 0x3F));
+        }
+        const bool eightbit = (0x20 <= c && c <= 0x7F) || c >= 0xA0;
+        const QR::Mode expected = c < 0x80 && QR::isNumeric(c) ? QR::Mode::numeric
+                                : c < 0x80 && QR::isAlphaNumeric(c) ? QR::Mode::alphanumeric
+                                : eightbit ? QR::Mode::eightbit : QR::Mode::eci;
+        EXPECT_EQ(expected, QR::classify(s)) << int(c);
+        EXPECT_EQ(expected, QR::classify(s + "0000000000000000")) << int(c);
+        EXPECT_EQ(expected, QR::classify("0000000000000000" + s)) << int(c);
+    }
+    
+    // character values
+    Data bits;
+    EXPECT_EQ(1, QR::encodeAlphanumeric(":", bits));
+    EXPECT_EQ(44, bits.at(0) >> 2);
+    bits.clear();
+    EXPECT_EQ(1, QR::encodeEightbit("ÿ", bits));
+    EXPECT_EQ(0xFF, bits.at(0));
+    bits.clear();
+    EXPECT_EQ(1, QR::encodeEightbit("&", bits));
+    EXPECT_EQ('&', bits.at(0));
+}
+
+
+TEST(QR, encodeNumericAlphanumeric) {
+    // the SIMD packers take 24 digits or 32 alphanumeric characters at a
+    // time, so compare lengths around multiples of those with packing one
+    // group at a time. Every 45 alphanumeric characters include all of them.
+    static constexpr std::string_view Alphanumeric = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:";
+    std::string digits, alphanumeric;
+    for (uint32_t i = 0; i < 200; ++i) {
+        digits.push_back('0' + ((i * 2654435761u) >> 16) % 10);
+        alphanumeric.push_back(Alphanumeric[i * 7 % 45]);
+    }
+    
+    for (size_t length = 1; length <= digits.size(); ++length) {
+        const std::string_view s = std::string_view(digits).substr(0, length);
+        Data expected;
+        expected.append(3, 5); // an offset, as after a header
+        for (size_t i = 0; i < length; i += 3) {
+            const size_t n = std::min(size_t{3}, length - i);
+            expected.append(3 * n + 1, std::stoul(std::string(s.substr(i, n))));
+        }
+        Data bits;
+        bits.append(3, 5);
+        EXPECT_EQ(length, QR::encodeNumeric(s, bits));
+        EXPECT_EQ(bits, expected) << s;
+    }
+    
+    for (size_t length = 1; length <= alphanumeric.size(); ++length) {
+        const std::string_view s = std::string_view(alphanumeric).substr(0, length);
+        Data expected;
+        expected.append(3, 5);
+        for (size_t i = 0; i + 1 < length; i += 2) {
+            expected.append(11, Alphanumeric.find(s[i]) * 45 + Alphanumeric.find(s[i + 1]));
+        }
+        if (length % 2 == 1) { expected.append(6, Alphanumeric.find(s.back())); }
+        Data bits;
+        bits.append(3, 5);
+        EXPECT_EQ(length, QR::encodeAlphanumeric(s, bits));
+        EXPECT_EQ(bits, expected) << s;
+    }
+}
+
+
+TEST(QR, encodeUtf8) {
+    // "€" is E2 82 AC in UTF-8
+    const QR::Segmentation segmentation = QR::segment("€", QRGen_EC_M);
+    ASSERT_TRUE(segmentation.success);
+    EXPECT_TRUE(segmentation.utf8);
+    ASSERT_EQ(1u, segmentation.segmentCount);
+    EXPECT_EQ(QR::Mode::eightbit, segmentation.segments[0].mode);
+    Data bits;
+    EXPECT_EQ(3, QR::encodeUtf8("€", bits));
+    Data expected;
+    expected.append(4, 0b0111);   // ECI
+    expected.append(8, 26);       // UTF-8
+    expected.append(4, 0b0100);   // byte mode
+    expected.append(8, 3);        // character count
+    expected.append(8, 0xE2);
+    expected.append(8, 0x82);
+    expected.append(8, 0xAC);
+    expected.append(4, 0b0000);   // terminator
+    EXPECT_EQ(QR::encodeSegments(segmentation, QRGen_EC_M), expected);
+    
+    EXPECT_FALSE(QR::segment("\xFF", QRGen_EC_M).success);
+    EXPECT_NE(0u, QR::encode("Produkt 商品 🙂").size());
+    EXPECT_EQ(0u, QR::encode("\xC3").size());
+}
+
+
+TEST(QR, encodeKanji) {
+    // the kanji mode example of section 7.4.6 of ISO/IEC 18004:2015: 点 is
+    // Shift JIS 0x935F, 茗 is 0xE4AA
+    Data bits;
+    EXPECT_EQ(2, QR::encodeKanji("点茗", bits));
+    Data expected;
+    expected.append(13, 0x0D9F);
+    expected.append(13, 0x1AAA);
+    EXPECT_EQ(bits, expected);
+    
+    // characters without a kanji value: ASCII, halfwidth katakana, and beyond
+    // the Basic Multilingual Plane
+    EXPECT_EQ(-1, kanjiValue(U'A'));
+    EXPECT_EQ(-1, kanjiValue(U'ｱ'));
+    EXPECT_EQ(-1, kanjiValue(U'🙂'));
+    EXPECT_EQ(0, kanjiValue(U'\u3000'));
+    
+    // Japanese text needs no ECI header
+    QR::Segmentation segmentation = QR::segment("商品コード", QRGen_EC_M);
+    ASSERT_TRUE(segmentation.success);
+    EXPECT_FALSE(segmentation.utf8);
+    ASSERT_EQ(1u, segmentation.segmentCount);
+    EXPECT_EQ(QR::Mode::kanji, segmentation.segments[0].mode);
+    EXPECT_EQ(4u + 8 + 5 * 13 + 4, QR::encodeSegments(segmentation, QRGen_EC_M).bitCount());
+    
+    segmentation = QR::segment("Produkt 商品 1234567890", QRGen_EC_M);
+    EXPECT_FALSE(segmentation.utf8);
+    ASSERT_EQ(4u, segmentation.segmentCount);
+    EXPECT_EQ(QR::Mode::eightbit, segmentation.segments[0].mode);
+    EXPECT_EQ(QR::Mode::kanji, segmentation.segments[1].mode);
+    EXPECT_EQ("商品", segmentation.segments[1].data);
+    EXPECT_EQ(QR::Mode::alphanumeric, segmentation.segments[2].mode); // " "
+    EXPECT_EQ(QR::Mode::numeric, segmentation.segments[3].mode);
+    
+    // but UTF-8 bytes where kanji are rare
+    segmentation = QR::segment("Produkt 商 Produkt 品", QRGen_EC_M);
+    EXPECT_TRUE(segmentation.utf8);
+    EXPECT_EQ(1u, segmentation.segmentCount);
+    
+    // kanji characters next to UTF-8 bytes
+    segmentation = QR::segment("€商品", QRGen_EC_M);
+    EXPECT_TRUE(segmentation.utf8);
+    ASSERT_EQ(2u, segmentation.segmentCount);
+    EXPECT_EQ(QR::Mode::kanji, segmentation.segments[1].mode);
+    EXPECT_NE(0u, QR::encode("商品コード").size());
+}
+
+
+TEST(QR, finalSequence) {
+    size_t maxCodewords = 0;
+    size_t maxEccCodewords = 0;
+    size_t maxBlocks = 0;
+    for (uint8_t version = 1; version <= 40; ++version) {
+        for (QRGen_ErrorCorrection ec : { QRGen_EC_L, QRGen_EC_M, QRGen_EC_Q, QRGen_EC_H }) {
+            // interleave the data codewords block by block, as in chapter 7.6
+            // of ISO/IEC 18004:2015
+            Data bits;
+            std::vector<std::vector<uint8_t>> blocks;
+            for (const std::array<uint16_t, 3> &counts : QR::ecBlocks[version - 1][ec]) {
+                for (size_t block = 0; block < counts[0]; ++block) {
+                    blocks.emplace_back();
+                    for (size_t i = 0; i < counts[2]; ++i) {
+                        blocks.back().push_back(bits.size() * 7 + 3);
+                        bits.append(8, blocks.back().back());
+                    }
+                }
+            }
+            std::vector<uint8_t> expected;
+            for (size_t i = 0; i < blocks.back().size(); ++i) {
+                for (const std::vector<uint8_t> &block : blocks) {
+                    if (i < block.size()) { expected.push_back(block[i]); }
+                }
+            }
+            
+            const std::vector<uint16_t> &positions = QR::interleaving(version, ec);
+            std::vector<uint8_t> sequence(positions.size());
+            QR::finalSequence(bits, version, ec, sequence);
+            EXPECT_TRUE(std::equal(expected.begin(), expected.end(), sequence.begin()));
+            
+            std::vector<uint16_t> sorted = positions;
+            std::sort(sorted.begin(), sorted.end());
+            for (size_t i = 0; i < sorted.size(); ++i) { ASSERT_EQ(i, sorted[i]); }
+            
+            maxCodewords = std::max(maxCodewords, positions.size());
+            maxEccCodewords = std::max<size_t>(maxEccCodewords, QR::ecCodewordsCounts[version - 1][ec]);
+            maxBlocks = std::max(maxBlocks, blocks.size());
+        }
+    }
+    EXPECT_EQ(QR::MaxCodewords, maxCodewords);
+    EXPECT_EQ(QR::MaxEccCodewords, maxEccCodewords);
+    EXPECT_EQ(QR::MaxBlocks, maxBlocks);
 }
@@ -0,0 +1,164 @@
+// Copyright 2024 Benjamin Lutz.
+// 
+// This file is part of QRGen. QRGen is free software: you can redistribute it
+// and/or modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation, either version 3 of the License,
+// or (at your option) any later version.
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+#include "qrgen.h"
+
+
+// Counts the allocations of the whole test binary, see encodeIntoAllocations.
+static std::atomic<size_t> allocationCount{0};
+
+void *operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size == 0 ? 1 : size)) { return p; }
+    throw std::bad_alloc();
+}
+
+// std::pmr::new_delete_resource() allocates with an alignment
+void *operator new(std::size_t size, std::align_val_t alignment) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    const size_t align = static_cast<size_t>(alignment);
+    if (void *p = std::aligned_alloc(align, (size + align - 1) / align * align)) { return p; }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete(void *p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+
+TEST(QRGen, encodeInto) {
+    static const char text[] = "HELLO WORLD";
+    
+    QRGen_Symbol *expected = QRGen_encode_ec(text, strlen(text), QRGen_EC_Q);
+    ASSERT_NE(expected, nullptr);
+    ASSERT_NE(expected->width, 0);
+    
+    std::unique_ptr<bool[]> data(new bool[QRGEN_MAX_WIDTH * QRGEN_MAX_WIDTH]);
+    QRGen_Symbol actual{0, 0, data.get()};
+    EXPECT_TRUE(QRGen_encode_into(text, strlen(text), QRGen_EC_Q,
+                                  &actual, QRGEN_MAX_WIDTH * QRGEN_MAX_WIDTH));
+    EXPECT_EQ(actual.width, expected->width);
+    EXPECT_EQ(actual.height, expected->height);
+    EXPECT_EQ(0, memcmp(actual.data, expected->data, expected->width * expected->height));
+    
+    // reuse the symbol allocated by QRGen_encode_ec()
+    EXPECT_TRUE(QRGen_encode_into(text, strlen(text), QRGen_EC_Q,
+                                  expected, expected->width * expected->height));
+    EXPECT_EQ(0, memcmp(actual.data, expected->data, expected->width * expected->height));
+    
+    QRGen_free_symbol(expected);
+}
+
+
+TEST(QRGen, encodeIntoTooSmall) {
+    static const char text[] = "HELLO WORLD";
+    bool data[20 * 20];
+    QRGen_Symbol symbol{1, 1, data};
+    EXPECT_FALSE(QRGen_encode_into(text, strlen(text), QRGen_EC_M, &symbol, 20 * 20));
+    EXPECT_EQ(symbol.width, 0);
+    EXPECT_EQ(symbol.height, 0);
+}
+
+
+TEST(QRGen, encodeIntoAllocations) {
+    // every mode, UTF-8 with an ECI header, and the capacities of version 40-H
+    std::vector<std::string> texts = { "0123456789012", "HELLO WORLD", "HTTPS://EX.COM/P/000123456789",
+                                       "Grüße, €100", "点茗 QR", std::string(3057, '7'), std::string() };
+    for (size_t i = 0; i < 1273; ++i) { texts.back().push_back('a' + i % 26); }
+    std::unique_ptr<bool[]> data(new bool[QRGEN_MAX_WIDTH * QRGEN_MAX_WIDTH]);
+    QRGen_Symbol symbol{0, 0, data.get()};
+    const QRGen_MaskPolicy policies[] = { {QRGen_Mask_Exhaustive, 0}, {QRGen_Mask_Heuristic, 0},
+                                          {QRGen_Mask_Deadline, 1000} };
+    
+    // The first encodes build the tables of their versions
+    for (int pass = 0; pass < 2; ++pass) {
+        const size_t allocations = allocationCount.load();
+        for (const std::string &text : texts) {
+            for (QRGen_ErrorCorrection ec : { QRGen_EC_L, QRGen_EC_H }) {
+                EXPECT_TRUE(QRGen_encode_into(text.data(), text.size(), ec, &symbol,
+                                              QRGEN_MAX_WIDTH * QRGEN_MAX_WIDTH));
+                for (const QRGen_MaskPolicy &policy : policies) {
+                    QRGen_encode_policy(text.data(), text.size(), ec, &policy, nullptr, &symbol,
+                                        QRGEN_MAX_WIDTH * QRGEN_MAX_WIDTH);
+                }
+            }
+        }
+        if (pass == 1) { EXPECT_EQ(allocations, allocationCount.load()); }
+    }
+}
+
+
+TEST(QRGen, encodePolicy) {
+    static const char text[] = "HELLO WORLD";
+    std::unique_ptr<bool[]> expectedData(new bool[QRGEN_MAX_WIDTH * QRGEN_MAX_WIDTH]);
+    std::unique_ptr<bool[]> actualData(new bool[QRGEN_MAX_WIDTH * QRGEN_MAX_WIDTH]);
+    QRGen_Symbol expected{0, 0, expectedData.get()};
+    QRGen_Symbol actual{0, 0, actualData.get()};
+    ASSERT_TRUE(QRGen_encode_into(text, strlen(text), QRGen_EC_Q, &expected, QRGEN_MAX_WIDTH * QRGEN_MAX_WIDTH));
+    
+    QRGen_MaskReport report;
+    EXPECT_TRUE(QRGen_encode_policy(text, strlen(text), QRGen_EC_Q, nullptr, &report,
+                                    &actual, QRGEN_MAX_WIDTH * QRGEN_MAX_WIDTH));
+    EXPECT_EQ(QRGen_Mask_Exhaustive, report.selection);
+    EXPECT_EQ(8, report.masksEvaluated);
+    EXPECT_GT(report.elapsedMicroseconds, 0.0);
+    EXPECT_EQ(0, memcmp(actual.data, expected.data, expected.width * expected.height));
+    
+    const QRGen_MaskPolicy deadline{QRGen_Mask_Deadline, 0};
+    EXPECT_TRUE(QRGen_encode_policy(text, strlen(text), QRGen_EC_Q, &deadline, &report,
+                                    &actual, QRGEN_MAX_WIDTH * QRGEN_MAX_WIDTH));
+    EXPECT_EQ(QRGen_Mask_Deadline, report.selection);
+    EXPECT_EQ(0, report.mask);
+    EXPECT_EQ(1, report.masksEvaluated);
+    
+    const QRGen_MaskPolicy heuristic{QRGen_Mask_Heuristic, 0};
+    EXPECT_TRUE(QRGen_encode_policy(text, strlen(text), QRGen_EC_Q, &heuristic, &report,
+                                    &actual, QRGEN_MAX_WIDTH * QRGEN_MAX_WIDTH));
+    EXPECT_EQ(actual.width, expected.width);
+    EXPECT_EQ(QRGen_Mask_Heuristic, report.selection);
+    EXPECT_LT(report.mask, 8);
+}
+
+
+TEST(QRGen, encodeBytes) {
+    // ISO 8859-1 bytes give the same QR code as the same text in UTF-8
+    static const uint8_t bytes[] = { 0xE4, 'h', 'n', 'l', 0xEE, 'c', 'h' };
+    static const char text[] = "ähnlîch";
+    QRGen_Symbol *expected = QRGen_encode_ec(text, strlen(text), QRGen_EC_H);
+    QRGen_Symbol *actual = QRGen_encode_bytes(bytes, sizeof(bytes), QRGen_EC_H);
+    ASSERT_NE(expected, nullptr);
+    ASSERT_NE(actual, nullptr);
+    ASSERT_EQ(actual->width, expected->width);
+    EXPECT_EQ(0, memcmp(actual->data, expected->data, expected->width * expected->height));
+    QRGen_free_symbol(expected);
+    QRGen_free_symbol(actual);
+    
+    // bytes which are not valid UTF-8, up to the capacity of version 40-L
+    std::vector<uint8_t> binary(2953);
+    for (size_t i = 0; i < binary.size(); ++i) { binary[i] = uint8_t(0xFF - i); }
+    actual = QRGen_encode_bytes(binary.data(), binary.size(), QRGen_EC_L);
+    ASSERT_NE(actual, nullptr);
+    EXPECT_EQ(actual->width, QRGEN_MAX_WIDTH);
+    QRGen_free_symbol(actual);
+    actual = QRGen_encode_bytes(binary.data(), 1, QRGen_EC_L);
+    ASSERT_NE(actual, nullptr);
+    EXPECT_EQ(actual->width, 21);
+    QRGen_free_symbol(actual);
+    
+    binary.push_back(0);
+    EXPECT_EQ(QRGen_encode_bytes(binary.data(), binary.size(), QRGen_EC_L), nullptr);
+    EXPECT_EQ(QRGen_encode_bytes(binary.data(), 0, QRGen_EC_L), nullptr);
+}
@@ -6,10 +6,15 @@
 // or (at your option) any later version.
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <array>
+#include <bit>
+#include <chrono>
+#include <limits>
 #include <vector>
 #include "qrgen.h"
 #define private public
+#include "../src/qr.h"
 #include "../src/symbol.h"
 
 
@@ -106,7 +111,7 @@ TEST(Symbol, formatInformation) {
     for (QRGen_ErrorCorrection ec : { QRGen_EC_M, QRGen_EC_L, QRGen_EC_H, QRGen_EC_Q }) {
         for (uint8_t mask = 0; mask < 8; ++mask, ++counter) {
             Symbol symbol(1);
-            symbol.setData({0}, ec, mask);
+            symbol.setData(std::vector<uint8_t>{0}, ec, mask);
             
             uint32_t f1 = 0;
             for (int i = 0; i < 8; ++i) {
@@ -150,3 +155,326 @@ TEST(Symbol, maskEvaluation) {
     EXPECT_EQ(720u, actual11311Pattern);
     EXPECT_EQ(50u, actualDarkProportion);
 }
+
+
+TEST(Symbol, modulePlane) {
+    // Rows are stored in 64 bit words; the bits past the end of a row must
+    // stay 0 so that rows can be processed a word at a time.
+    for (uint8_t version = 1; version <= 40; ++version) {
+        Symbol symbol(version);
+        std::vector<uint8_t> data(symbol.size() * symbol.size() / 8);
+        for (size_t i = 0; i < data.size(); ++i) { data[i] = i * 167 + 13; }
+        symbol.setData(data, QRGen_EC_Q, version % 8);
+        
+        const size_t size = symbol.size();
+        EXPECT_EQ((size + 63) / 64, symbol.stride());
+        EXPECT_EQ(size * symbol.stride(), symbol.modules().size());
+        for (size_t y = 0; y < size; ++y) {
+            const std::span<const uint64_t> row = symbol.row(y);
+            for (size_t x = 0; x < 64 * symbol.stride(); ++x) {
+                const bool bit = (row[x / 64] >> (x % 64)) & 1;
+                EXPECT_EQ(x < size ? symbol.pixel(x, y) : false, bit)
+                    << "version " << int(version) << ", " << x << "/" << y;
+            }
+        }
+    }
+}
+
+
+TEST(Symbol, setModules) {
+    // Spans crossing word boundaries and the symbol's edges
+    Symbol symbol(40);
+    symbol.setModules(-3, 0, 200, true);
+    symbol.setModules(0, 1, symbol.size(), false);
+    symbol.setModules(60, 1, 10, true);
+    symbol.setModules(64, 1, 2, false);
+    for (int x = 0; x < int(symbol.size()); ++x) {
+        EXPECT_TRUE(symbol.module(x, 0)) << x;
+        EXPECT_EQ(60 <= x && x < 70 && x != 64 && x != 65, symbol.module(x, 1)) << x;
+    }
+    EXPECT_EQ(0u, symbol.row(0)[2] >> (symbol.size() - 128));
+}
+
+
+TEST(Symbol, functionPatterns) {
+    // Remainder bits per version, from table 1 of ISO/IEC 18004:2015
+    static auto remainderBits = [](int version) -> size_t {
+        if (2 <= version && version <= 6) { return 7; }
+        if (14 <= version && version <= 20) { return 3; }
+        if (21 <= version && version <= 27) { return 4; }
+        if (28 <= version && version <= 34) { return 3; }
+        return 0;
+    };
+    
+    for (uint8_t version = 1; version <= 40; ++version) {
+        const Symbol::Template &functionPatterns = Symbol::functionPatterns(version);
+        EXPECT_EQ(&functionPatterns, &Symbol::functionPatterns(version));
+        
+        // The modules which are not function modules hold exactly the
+        // codewords and the remainder bits.
+        size_t functionModuleCount = 0;
+        for (uint64_t word : functionPatterns.functionModules) { functionModuleCount += std::popcount(word); }
+        size_t codewordCount = 0;
+        for (const std::array<uint16_t, 3> &counts : QR::ecBlocks[version - 1][QRGen_EC_L]) {
+            codewordCount += counts[0] * counts[1];
+        }
+        const Symbol symbol(version);
+        EXPECT_EQ(symbol.size() * symbol.size() - functionModuleCount, 8 * codewordCount + remainderBits(version))
+            << "version " << int(version);
+        
+        // A new symbol is a copy of the template
+        EXPECT_TRUE(std::ranges::equal(functionPatterns.modules, symbol.modules()));
+        EXPECT_TRUE(std::ranges::equal(functionPatterns.pixelType, symbol.pixelType()));
+        EXPECT_TRUE(symbol._pixelType.empty());
+        EXPECT_EQ(Symbol::PixelType::FormatInformation, symbol.pixelType()[symbol.toIndex(8, symbol.size() - 8)]);
+    }
+}
+
+
+TEST(Symbol, placement) {
+    for (uint8_t version = 1; version <= 40; ++version) {
+        const Symbol::Template &functionPatterns = Symbol::functionPatterns(version);
+        const std::vector<uint16_t> &placement = functionPatterns.placement;
+        
+        // every data module is placed exactly once
+        std::vector<uint64_t> placed(functionPatterns.functionModules.size());
+        for (uint16_t bitIndex : placement) {
+            EXPECT_EQ(0u, (placed[bitIndex / 64] >> (bitIndex % 64)) & 1) << bitIndex;
+            placed[bitIndex / 64] |= uint64_t{1} << (bitIndex % 64);
+        }
+        for (size_t i = 0; i < placed.size(); ++i) {
+            EXPECT_EQ(0u, placed[i] & functionPatterns.functionModules[i]) << "version " << int(version);
+        }
+        size_t moduleCount = 0;
+        for (uint64_t word : placed) { moduleCount += std::popcount(word); }
+        EXPECT_EQ(placement.size(), moduleCount);
+    }
+    
+    // The first codeword fills the 2x4 modules in the bottom right corner,
+    // upwards from right to left (figure 13 of ISO/IEC 18004:2015).
+    Symbol symbol(1);
+    symbol.highlightCodeword(0, 7);
+    for (int y = 0; y < 21; ++y) {
+        for (int x = 0; x < 21; ++x) {
+            EXPECT_EQ(x >= 19 && y >= 17 ? 7u : 0u, symbol.highlight(x, y)) << x << "/" << y;
+        }
+    }
+    const std::array<Symbol::Position, 8> positions = symbol.position(0);
+    EXPECT_EQ(20, positions[0].x);
+    EXPECT_EQ(20, positions[0].y);
+    EXPECT_EQ(19, positions[1].x);
+    EXPECT_EQ(20, positions[1].y);
+    EXPECT_EQ(20, positions[2].x);
+    EXPECT_EQ(19, positions[2].y);
+    EXPECT_FALSE(symbol.position(26)[0].valid()); // version 1 has 26 codewords
+}
+
+
+TEST(Symbol, maskPlanes) {
+    // Table 10 of ISO/IEC 18004:2015, i being the row and j the column
+    static const std::array<bool (*)(int, int), 8> maskConditions = {
+        [](int i, int j) { return (i + j) % 2 == 0; },
+        [](int i, int j) { (void)j; return i % 2 == 0; },
+        [](int i, int j) { (void)i; return j % 3 == 0; },
+        [](int i, int j) { return (i + j) % 3 == 0; },
+        [](int i, int j) { return (i / 2 + j / 3) % 2 == 0; },
+        [](int i, int j) { return (i * j) % 2 + (i * j) % 3 == 0; },
+        [](int i, int j) { return ((i * j) % 2 + (i * j) % 3) % 2 == 0; },
+        [](int i, int j) { return ((i + j) % 2 + (i * j) % 3) % 2 == 0; },
+    };
+    
+    for (uint8_t version = 1; version <= 40; ++version) {
+        const Symbol::Template &functionPatterns = Symbol::functionPatterns(version);
+        const size_t size = 17 + 4 * version;
+        const size_t stride = (size + 63) / 64;
+        for (size_t mask = 0; mask < 8; ++mask) {
+            const std::vector<uint64_t> &maskPlane = functionPatterns.maskPlanes[mask];
+            for (size_t y = 0; y < size; ++y) {
+                for (size_t x = 0; x < 64 * stride; ++x) {
+                    const size_t word = y * stride + x / 64;
+                    const bool dataModule = x < size && !((functionPatterns.functionModules[word] >> (x % 64)) & 1);
+                    EXPECT_EQ(dataModule && maskConditions[mask](y, x), (maskPlane[word] >> (x % 64)) & 1)
+                        << "version " << int(version) << ", mask " << mask << ", " << x << "/" << y;
+                }
+            }
+        }
+    }
+}
+
+
+TEST(Symbol, penaltyMethods) {
+    // The bitboard penalties must be identical to the reference ones, for
+    // symbols of all sizes, including ones with long runs.
+    for (uint8_t version = 1; version <= 40; ++version) {
+        Symbol symbol(version);
+        std::vector<uint8_t> data(symbol.size() * symbol.size() / 8);
+        for (size_t i = 0; i < data.size(); ++i) { data[i] = i % 97 < 40 ? 0 : i * 167 + 13; }
+        for (uint8_t mask = 0; mask < 8; ++mask) {
+            symbol.setData(data, QRGen_EC_M, mask);
+            EXPECT_EQ(symbol.evaluateAdjacentSameColor(), symbol.evaluateAdjacentSameColorBitboard(symbol.transposed()))
+                << "version " << int(version) << ", mask " << int(mask);
+            EXPECT_EQ(symbol.evaluateSameColorBlocks(), symbol.evaluateSameColorBlocksBitboard())
+                << "version " << int(version) << ", mask " << int(mask);
+            EXPECT_EQ(symbol.evaluate(Symbol::PenaltyMethod::Reference),
+                      symbol.evaluate(Symbol::PenaltyMethod::Bitboard));
+        }
+        
+        const Symbol::ModulePlane columns = symbol.transposed();
+        for (size_t y = 0; y < symbol.size(); ++y) {
+            for (size_t x = 0; x < symbol.size(); ++x) {
+                EXPECT_EQ(symbol.pixel(x, y), (columns[x * symbol.stride() + y / 64] >> (y % 64)) & 1);
+            }
+        }
+        
+        // a single color
+        std::fill(symbol._modules.begin(), symbol._modules.end(), 0);
+        EXPECT_EQ(symbol.evaluateAdjacentSameColor(), symbol.evaluateAdjacentSameColorBitboard(symbol.transposed()));
+        EXPECT_EQ(symbol.evaluateSameColorBlocks(), symbol.evaluateSameColorBlocksBitboard());
+        for (size_t y = 0; y < symbol.size(); ++y) { symbol.setModules(0, y, symbol.size(), true); }
+        EXPECT_EQ(symbol.evaluateAdjacentSameColor(), symbol.evaluateAdjacentSameColorBitboard(symbol.transposed()));
+        EXPECT_EQ(symbol.evaluateSameColorBlocks(), symbol.evaluateSameColorBlocksBitboard());
+    }
+}
+
+
+TEST(Symbol, finderPenaltyRunLength) {
+    // Fill rows with finder-like patterns of various scales, some of them at
+    // the edges, and random runs in between, so that both rows and columns
+    // contain patterns. Both finder penalty rules must score the same with
+    // either method.
+    using FinderPenalty = Symbol::FinderPenalty;
+    
+    uint32_t random = 12345;
+    auto next = [&](uint32_t n) -> uint32_t {
+        random = random * 1103515245 + 12345;
+        return (random >> 16) % n;
+    };
+    
+    unsigned int scaledPenalty = 0;
+    for (uint8_t version : { 1, 2, 5, 10, 21, 40 }) {
+        for (int round = 0; round < 4; ++round) {
+            Symbol symbol(version);
+            const int size = symbol.size();
+            for (int y = 0; y < size; ++y) {
+                int x = next(3) == 0 ? 0 : -int(next(8));
+                while (x < size) {
+                    if (next(3) == 0) {
+                        const int scale = 1 + next(4);
+                        const int light = 4 * scale - next(2);
+                        symbol.setModules(x, y, light, false);
+                        x += light;
+                        for (auto [run, dark] : { std::pair{1, true}, {1, false}, {3, true}, {1, false}, {1, true} }) {
+                            symbol.setModules(x, y, run * scale, dark);
+                            x += run * scale;
+                        }
+                    } else {
+                        const int length = 1 + next(6);
+                        symbol.setModules(x, y, length, next(2));
+                        x += length;
+                    }
+                }
+            }
+            
+            const Symbol::ModulePlane columns = symbol.transposed();
+            for (FinderPenalty finderPenalty : { FinderPenalty::Compatible, FinderPenalty::Strict }) {
+                EXPECT_EQ(symbol.evaluate11311Pattern(finderPenalty),
+                          symbol.evaluate11311PatternRunLength(columns, finderPenalty))
+                    << "version " << int(version) << ", round " << round << ", rule " << int(finderPenalty);
+            }
+            scaledPenalty += symbol.evaluate11311Pattern(FinderPenalty::Compatible)
+                - symbol.evaluate11311Pattern(FinderPenalty::Strict);
+        }
+    }
+    EXPECT_GT(scaledPenalty, 0u); // patterns with a scale > 1 were tested
+}
+
+
+TEST(Symbol, maskSelection) {
+    // The penalty bounds must not exceed the scores of any mask, and pruning
+    // must not change which mask is selected.
+    using FinderPenalty = Symbol::FinderPenalty;
+    
+    Symbol::resetMaskStatistics();
+    for (uint8_t version = 1; version <= 40; ++version) {
+        Symbol symbol(version);
+        const Symbol::PenaltyBounds &bounds = symbol._template->penaltyBounds;
+        std::vector<uint8_t> data(symbol.size() * symbol.size() / 8);
+        for (size_t i = 0; i < data.size(); ++i) { data[i] = i % (31 + version) < 12 ? 0 : i * 167 + version; }
+        
+        for (FinderPenalty finderPenalty : { FinderPenalty::Compatible, FinderPenalty::Strict }) {
+            unsigned int lowestPenalty = std::numeric_limits<unsigned int>::max();
+            uint8_t expectedMask = 0;
+            for (uint8_t mask = 0; mask < 8; ++mask) {
+                symbol.setData(data, QRGen_EC_Q, mask);
+                const Symbol::ModulePlane columns = symbol.transposed();
+                EXPECT_LE(bounds.adjacentSameColor, symbol.evaluateAdjacentSameColorBitboard(columns));
+                EXPECT_LE(bounds.sameColorBlocks, symbol.evaluateSameColorBlocksBitboard());
+                EXPECT_LE(bounds.pattern11311[size_t(finderPenalty)],
+                          symbol.evaluate11311PatternRunLength(columns, finderPenalty));
+                const unsigned int penalty = symbol.evaluate(Symbol::PenaltyMethod::Bitboard, finderPenalty);
+                if (penalty < lowestPenalty) {
+                    lowestPenalty = penalty;
+                    expectedMask = mask;
+                }
+            }
+            
+            symbol.setData(data, QRGen_EC_Q, 255, {.finderPenalty = finderPenalty});
+            EXPECT_EQ(expectedMask, symbol.maskReport().mask) << "version " << int(version);
+            EXPECT_EQ(8, symbol.maskReport().masksEvaluated);
+        }
+    }
+    EXPECT_GT(Symbol::functionPatterns(40).penaltyBounds.sameColorBlocks, 0u);
+    
+    const Symbol::MaskStatistics statistics = Symbol::maskStatistics();
+    EXPECT_EQ(80u, statistics.selections);
+    EXPECT_EQ(0u, statistics.pruned[0]);
+    uint64_t pruned = 0;
+    for (uint64_t count : statistics.pruned) { pruned += count; }
+    EXPECT_GT(pruned, 0u);
+}
+
+
+TEST(Symbol, maskPolicy) {
+    Symbol symbol(25);
+    std::vector<uint8_t> data(symbol.size() * symbol.size() / 8);
+    for (size_t i = 0; i < data.size(); ++i) { data[i] = i * 2654435761u >> 24; }
+    
+    symbol.setData(data, QRGen_EC_M);
+    const Symbol::MaskReport exhaustive = symbol.maskReport();
+    EXPECT_EQ(QRGen_Mask_Exhaustive, exhaustive.selection);
+    EXPECT_EQ(8, exhaustive.masksEvaluated);
+    EXPECT_GT(exhaustive.elapsed.count(), 0);
+    
+    // the heuristic selects the mask with the lowest N1, N2 and N4 penalty
+    unsigned int lowestPenalty = std::numeric_limits<unsigned int>::max();
+    uint8_t expectedMask = 0;
+    for (uint8_t mask = 0; mask < 8; ++mask) {
+        symbol.setData(data, QRGen_EC_M, mask);
+        EXPECT_EQ(0, symbol.maskReport().masksEvaluated);
+        const unsigned int penalty = symbol.evaluateAdjacentSameColor() + symbol.evaluateSameColorBlocks()
+                                   + symbol.evaluateDarkProportion();
+        if (penalty < lowestPenalty) {
+            lowestPenalty = penalty;
+            expectedMask = mask;
+        }
+    }
+    symbol.setData(data, QRGen_EC_M, 255, {.selection = QRGen_Mask_Heuristic});
+    EXPECT_EQ(QRGen_Mask_Heuristic, symbol.maskReport().selection);
+    EXPECT_EQ(expectedMask, symbol.maskReport().mask);
+    EXPECT_EQ(8, symbol.maskReport().masksEvaluated);
+    
+    // without a budget, only the first mask is scored
+    symbol.setData(data, QRGen_EC_M, 255, {.selection = QRGen_Mask_Deadline});
+    EXPECT_EQ(QRGen_Mask_Deadline, symbol.maskReport().selection);
+    EXPECT_EQ(0, symbol.maskReport().mask);
+    EXPECT_EQ(1, symbol.maskReport().masksEvaluated);
+    Symbol expected(25);
+    expected.setData(data, QRGen_EC_M, 0);
+    EXPECT_TRUE(std::ranges::equal(expected.modules(), symbol.modules()));
+    
+    // with enough time, the selection is exhaustive
+    symbol.setData(data, QRGen_EC_M, 255, {.selection = QRGen_Mask_Deadline, .budget = std::chrono::seconds(100)});
+    EXPECT_EQ(QRGen_Mask_Exhaustive, symbol.maskReport().selection);
+    EXPECT_EQ(exhaustive.mask, symbol.maskReport().mask);
+    EXPECT_EQ(8, symbol.maskReport().masksEvaluated);
+}